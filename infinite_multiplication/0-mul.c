@@ -1,7 +1,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
-#include <ctype.h>
+#include "mul.h"
 
 /**
  * is_number - check if a number is in base 10.
@@ -10,33 +10,31 @@
  */
 int is_number(const char *num)
 {
-	int i = 0;
-
-	if (num == NULL || strlen(num) == 0 || num[0] == '-')
+	if (num == NULL || num[0] == '\0')
 		return (0);
 
-	for (; num[i] != '\0'; i++)
-		if (!isdigit(num[i]))
-			return (0);
-
-	return (1);
+	return (mul_is_digits(num, strlen(num)));
 }
 
 /**
  * print_result - Print the multiplication result
- * @result: Array containing the result digits
- * @len: Length of the result array
+ * @r: Limbs of the result, least significant first
+ * @n: Number of limbs, leading zero limbs are skipped
  */
-void print_result(int *result, int len)
+void print_result(const uint32_t *r, size_t n)
 {
-	int start = 0, i;
-
-	while (start < len - 1 && result[start] == 0)
-		start++;
+	char *buf = malloc(MUL_DIGITS * n + 2);
+	size_t len;
 
-	for (i = start; i < len; i++)
-		printf("%d", result[i]);
-	printf("\n");
+	if (!buf)
+	{
+		printf("Error\n");
+		exit(98);
+	}
+	len = mul_to_string(buf, r, n);
+	buf[len++] = '\n';
+	fwrite(buf, 1, len, stdout);
+	free(buf);
 }
 
 /**
@@ -46,37 +44,37 @@ void print_result(int *result, int len)
  */
 void multiply_big_numbers(const char *num1, const char *num2)
 {
-	int len1 = strlen(num1), len2 = strlen(num2);
-	int result_len = len1 + len2, i, j;
-	int *result = calloc(result_len, sizeof(int));
+	size_t len1 = strlen(num1), len2 = strlen(num2);
+	size_t n1 = MUL_LIMBS(len1), n2 = MUL_LIMBS(len2);
+	uint32_t *a = malloc(sizeof(*a) * 2 * (n1 + n2)), *b, *r;
+	char const *threads = getenv("MUL_THREADS");
 
-	if (!result)
+	if (!a)
 	{
 		printf("Error\n");
 		exit(98);
 	}
-	if (strcmp(num1, "0") == 0 || strcmp(num2, "0") == 0)
+	b = a + n1;
+	r = b + n2;
+	n1 = mul_parse(a, num1, len1);
+	n2 = mul_parse(b, num2, len2);
+	if (n1 == n2 && memcmp(a, b, sizeof(*a) * n1) == 0)
+		b = a;
+	if (n1 == 0 || n2 == 0)
 	{
 		printf("0\n");
-		free(result);
+		free(a);
 		return;
 	}
-
-	for (i = len1 - 1; i >= 0; i--)
+	if (mul_limbs_parallel(r, a, n1, b, n2,
+			       threads ? atoi(threads) : 0) == -1)
 	{
-		for (j = len2 - 1; j >= 0; j--)
-		{
-			int product = (num1[i] - '0') * (num2[j] - '0');
-			int pos = i + j + 1;
-			int sum = product + result[pos];
-
-			result[pos] = sum % 10;
-			result[pos - 1] += sum / 10;
-		}
+		printf("Error\n");
+		free(a);
+		exit(98);
 	}
-
-	print_result(result, result_len);
-	free(result);
+	print_result(r, n1 + n2);
+	free(a);
 }
 
 /**
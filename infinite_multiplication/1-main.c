@@ -0,0 +1,69 @@
+#include "mul.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * print_num - Prints a number, its digits taken from the arena and
+ * released right away
+ *
+ * @name: Label of the number
+ * @x: Number to print
+ * @ar: Arena the digits are written in
+ */
+void print_num(char const *name, const mul_num_t *x, mul_arena_t *ar)
+{
+    size_t mark = ar->used;
+    char *s = mul_num_to_string(x, ar);
+
+    printf("%-7s = %s\n", name, s ? s : "(arena full)");
+    ar->used = mark;
+}
+
+/**
+ * main - Runs every function of the library API in a fixed-size arena,
+ * then fills up a tiny one
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(void)
+{
+    static unsigned char mem[4096];
+    uint64_t tiny[4];
+    char const *x = "123456789012345678901234567890";
+    char const *y = "987654321098765432109876543210";
+    mul_arena_t ar;
+    mul_num_t a, b, r;
+    size_t mark;
+
+    mul_arena_init(&ar, mem, sizeof(mem));
+    if (mul_num_parse(&a, x, strlen(x), &ar) == -1 ||
+        mul_num_parse(&b, y, strlen(y), &ar) == -1)
+        return (1);
+    mark = ar.used;
+    if (mul_num_mul(&r, &a, &b, &ar) == 0)
+        print_num("a * b", &r, &ar);
+    if (mul_num_square(&r, &a, &ar) == 0)
+        print_num("a * a", &r, &ar);
+    if (mul_num_add(&r, &a, &b, &ar) == 0)
+        print_num("a + b", &r, &ar);
+    if (mul_num_sub(&r, &b, &a, &ar) == 0)
+        print_num("b - a", &r, &ar);
+    printf("a - b: %d\n", mul_num_sub(&r, &a, &b, &ar));
+    printf("cmp(a, b): %d\n", mul_num_cmp(&a, &b));
+    printf("parse \"12x4\": %d\n", mul_num_parse(&r, "12x4", 4, &ar));
+    ar.used = mark;
+    printf("arena: %lu of %lu bytes used\n", (unsigned long)ar.used,
+           (unsigned long)ar.size);
+
+    mul_arena_init(&ar, tiny, sizeof(tiny));
+    if (mul_num_parse(&a, x, strlen(x), &ar) == -1)
+        return (1);
+    mark = ar.used;
+    printf("a * a needs %lu bytes, %lu left\n",
+           (unsigned long)mul_num_mul_size(a.n, a.n),
+           (unsigned long)(ar.size - ar.used));
+    printf("a * a: %d\n", mul_num_square(&r, &a, &ar));
+    printf("arena: %lu bytes used, %s\n", (unsigned long)ar.used,
+           ar.used == mark ? "as before" : "changed");
+    return (0);
+}
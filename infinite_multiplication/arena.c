@@ -0,0 +1,59 @@
+#include "mul.h"
+
+
+/**
+ * mul_arena_init - Sets up an arena over a block of caller memory
+ *
+ * The library never allocates memory of its own once given an arena:
+ * every number and temporary buffer comes from @mem.
+ *
+ * @ar: Arena to set up
+ * @mem: Memory handed out by the arena, owned by the caller
+ * @size: Number of bytes of @mem
+ */
+void mul_arena_init(mul_arena_t *ar, void *mem, size_t size)
+{
+	size_t pad = -(size_t)(uintptr_t)mem & (MUL_ARENA_ALIGN - 1);
+
+	ar->base = (unsigned char *)mem + pad;
+	ar->size = size > pad ? size - pad : 0;
+	ar->size &= ~(size_t)(MUL_ARENA_ALIGN - 1);
+	ar->used = 0;
+}
+
+
+/**
+ * mul_arena_alloc - Hands out a block of an arena
+ *
+ * @ar: Arena to allocate from
+ * @size: Number of bytes of the block, may be 0
+ *
+ * Return: The block, aligned on MUL_ARENA_ALIGN, or NULL if the arena is
+ * full
+ */
+void *mul_arena_alloc(mul_arena_t *ar, size_t size)
+{
+	void *p;
+
+	if (size > ar->size - ar->used)
+		return (NULL);
+	p = ar->base + ar->used;
+	ar->used += MUL_ARENA_ROUND(size);
+	return (p);
+}
+
+
+/**
+ * mul_num_mul_size - Computes the arena bytes needed by mul_num_mul
+ *
+ * @na: Number of limbs of the first number
+ * @nb: Number of limbs of the second number
+ *
+ * Return: The bytes taken by the product and the scratch space of the
+ * multiplication, released once it returns
+ */
+size_t mul_num_mul_size(size_t na, size_t nb)
+{
+	return (MUL_ARENA_ROUND(sizeof(uint32_t) * (na + nb)) +
+		MUL_ARENA_ROUND(sizeof(uint32_t) * mul_scratch_size(na, nb)));
+}
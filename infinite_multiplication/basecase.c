@@ -0,0 +1,42 @@
+#include "mul.h"
+
+
+/**
+ * mul_basecase - Multiplies two numbers with the schoolbook method
+ *
+ * Each limb of the product is computed as a whole column of limb
+ * products, summed MUL_FOLD at a time in 64 bits before being split
+ * into a limb and a carry: the inner loop is a plain multiply-add, with
+ * one division per MUL_FOLD products instead of one per digit product.
+ *
+ * @r: Receives the na + nb limbs of the product, must not overlap a or b
+ * @a: First number
+ * @na: Number of limbs of @a, at least 1
+ * @b: Second number
+ * @nb: Number of limbs of @b, at least 1
+ */
+void mul_basecase(uint32_t *r, const uint32_t *a, size_t na,
+		  const uint32_t *b, size_t nb)
+{
+	uint64_t carry = 0, sum, low;
+	size_t k, i, first, last, stop;
+
+	for (k = 0; k + 1 < na + nb; k++)
+	{
+		first = k < nb ? 0 : k - nb + 1;
+		last = k < na ? k + 1 : na;
+		low = carry % MUL_BASE;
+		carry /= MUL_BASE;
+		for (i = first; i < last; )
+		{
+			stop = last - i > MUL_FOLD ? i + MUL_FOLD : last;
+			for (sum = 0; i < stop; i++)
+				sum += (uint64_t)a[i] * b[k - i];
+			low += sum % MUL_BASE;
+			carry += sum / MUL_BASE;
+		}
+		r[k] = (uint32_t)(low % MUL_BASE);
+		carry += low / MUL_BASE;
+	}
+	r[na + nb - 1] = (uint32_t)carry;
+}
@@ -0,0 +1,129 @@
+#include "mul.h"
+
+
+/**
+ * mul_num_parse - Converts a string of decimal digits into a number
+ *
+ * @x: Receives the number, its limbs held by @ar
+ * @s: Digits, most significant first, need not be NUL-terminated
+ * @len: Number of digits
+ * @ar: Arena the limbs are allocated from
+ *
+ * Return: 0 on success, -1 if @s is not a number or the arena is full
+ */
+int mul_num_parse(mul_num_t *x, char const *s, size_t len, mul_arena_t *ar)
+{
+	uint32_t *limbs;
+
+	if (!s || len == 0 || !mul_is_digits(s, len))
+		return (-1);
+	limbs = mul_arena_alloc(ar, sizeof(*limbs) * MUL_LIMBS(len));
+	if (!limbs)
+		return (-1);
+	x->limbs = limbs;
+	x->n = mul_parse(limbs, s, len);
+	return (0);
+}
+
+
+/**
+ * mul_num_mul - Multiplies two numbers
+ *
+ * The product is allocated from the arena first, then the scratch space,
+ * which is released before returning: mul_num_mul_size(a->n, b->n) bytes
+ * of arena are enough. @r may be @a or @b.
+ *
+ * @r: Receives the product
+ * @a: First number
+ * @b: Second number
+ * @ar: Arena the product and scratch space are allocated from
+ *
+ * Return: 0 on success, -1 if the arena is full
+ */
+int mul_num_mul(mul_num_t *r, const mul_num_t *a, const mul_num_t *b,
+		mul_arena_t *ar)
+{
+	size_t start = ar->used, mark;
+	uint32_t *limbs, *scratch;
+
+	if (a->n == 0 || b->n == 0)
+	{
+		r->limbs = NULL;
+		r->n = 0;
+		return (0);
+	}
+	limbs = mul_arena_alloc(ar, sizeof(*limbs) * (a->n + b->n));
+	mark = ar->used;
+	scratch = mul_arena_alloc(ar, sizeof(*scratch) *
+				  mul_scratch_size(a->n, b->n));
+	if (!limbs || !scratch)
+	{
+		ar->used = start;
+		return (-1);
+	}
+	mul_limbs(limbs, a->limbs, a->n, b->limbs, b->n, scratch);
+	ar->used = mark;
+	r->n = mul_norm(limbs, a->n + b->n);
+	r->limbs = limbs;
+	return (0);
+}
+
+
+/**
+ * mul_num_square - Squares a number
+ *
+ * Goes through mul_sqr, about half the work of a general product; needs
+ * mul_num_mul_size(a->n, a->n) bytes of arena.
+ *
+ * @r: Receives the square, may be @a
+ * @a: Number to square
+ * @ar: Arena the square and scratch space are allocated from
+ *
+ * Return: 0 on success, -1 if the arena is full
+ */
+int mul_num_square(mul_num_t *r, const mul_num_t *a, mul_arena_t *ar)
+{
+	return (mul_num_mul(r, a, a, ar));
+}
+
+
+/**
+ * mul_num_cmp - Compares two numbers
+ *
+ * @a: First number
+ * @b: Second number
+ *
+ * Return: A negative value if a < b, 0 if a == b, a positive value
+ * if a > b
+ */
+int mul_num_cmp(const mul_num_t *a, const mul_num_t *b)
+{
+	size_t i = a->n;
+
+	if (a->n != b->n)
+		return (a->n < b->n ? -1 : 1);
+	while (i > 0 && a->limbs[i - 1] == b->limbs[i - 1])
+		i--;
+	if (i == 0)
+		return (0);
+	return (a->limbs[i - 1] < b->limbs[i - 1] ? -1 : 1);
+}
+
+
+/**
+ * mul_num_to_string - Writes the decimal digits of a number
+ *
+ * @x: Number to write
+ * @ar: Arena the string is allocated from, 9 bytes per limb plus 2
+ *
+ * Return: The NUL-terminated digits, "0" for zero, or NULL if the arena
+ * is full
+ */
+char *mul_num_to_string(const mul_num_t *x, mul_arena_t *ar)
+{
+	char *s = mul_arena_alloc(ar, MUL_DIGITS * x->n + 2);
+
+	if (s)
+		s[mul_to_string(s, x->limbs, x->n)] = '\0';
+	return (s);
+}
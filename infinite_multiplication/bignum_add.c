@@ -0,0 +1,61 @@
+#include "mul.h"
+
+
+/**
+ * mul_num_add - Adds two numbers
+ *
+ * @r: Receives the sum, may be @a or @b
+ * @a: First number
+ * @b: Second number
+ * @ar: Arena the sum is allocated from, 4 bytes per limb of the longer
+ * number plus 8
+ *
+ * Return: 0 on success, -1 if the arena is full
+ */
+int mul_num_add(mul_num_t *r, const mul_num_t *a, const mul_num_t *b,
+		mul_arena_t *ar)
+{
+	const mul_num_t *tmp;
+	uint32_t *limbs;
+
+	if (a->n < b->n)
+	{
+		tmp = a;
+		a = b;
+		b = tmp;
+	}
+	limbs = mul_arena_alloc(ar, sizeof(*limbs) * (a->n + 1));
+	if (!limbs)
+		return (-1);
+	limbs[a->n] = mul_add(limbs, a->limbs, a->n, b->limbs, b->n);
+	r->n = mul_norm(limbs, a->n + 1);
+	r->limbs = limbs;
+	return (0);
+}
+
+
+/**
+ * mul_num_sub - Subtracts a number from another one
+ *
+ * @r: Receives the difference, may be @a or @b
+ * @a: Number to subtract from
+ * @b: Number to subtract, at most @a
+ * @ar: Arena the difference is allocated from, 4 bytes per limb of @a
+ *
+ * Return: 0 on success, -1 if b is greater than a or the arena is full
+ */
+int mul_num_sub(mul_num_t *r, const mul_num_t *a, const mul_num_t *b,
+		mul_arena_t *ar)
+{
+	uint32_t *limbs;
+
+	if (mul_num_cmp(a, b) < 0)
+		return (-1);
+	limbs = mul_arena_alloc(ar, sizeof(*limbs) * a->n);
+	if (!limbs)
+		return (-1);
+	mul_sub(limbs, a->limbs, a->n, b->limbs, b->n);
+	r->n = mul_norm(limbs, a->n);
+	r->limbs = limbs;
+	return (0);
+}
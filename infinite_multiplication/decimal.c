@@ -0,0 +1,155 @@
+#include <string.h>
+#include "mul.h"
+
+#define ONES UINT64_C(0x0101010101010101)
+
+static char const pairs[] =
+	"00010203040506070809101112131415161718192021222324"
+	"25262728293031323334353637383940414243444546474849"
+	"50515253545556575859606162636465666768697071727374"
+	"75767778798081828384858687888990919293949596979899";
+
+
+/**
+ * mul_is_digits - Checks that a string holds only decimal digits
+ *
+ * Checks 8 characters per step: a byte is a digit if its high nibble is
+ * 3 and adding 6 to it does not change that.
+ *
+ * @s: String to check
+ * @len: Number of characters of @s
+ *
+ * Return: 1 if every character is a digit, 0 otherwise
+ */
+int mul_is_digits(char const *s, size_t len)
+{
+	uint64_t w;
+	size_t i;
+
+	for (i = 0; i + 8 <= len; i += 8)
+	{
+		memcpy(&w, s + i, sizeof(w));
+		if ((w & 0xF0 * ONES) != 0x30 * ONES ||
+		    ((w + 0x06 * ONES) & 0xF0 * ONES) != 0x30 * ONES)
+			return (0);
+	}
+	for (; i < len; i++)
+		if (s[i] < '0' || s[i] > '9')
+			return (0);
+	return (1);
+}
+
+
+/**
+ * parse9 - Converts 9 decimal digits into a limb
+ *
+ * On little-endian CPUs, the last 8 digits are converted at once: pairs
+ * of digits, then pairs of pairs, then the two halves are combined in
+ * place within a 64-bit word.
+ *
+ * @s: Digits, most significant first
+ *
+ * Return: The value of the digits
+ */
+static uint32_t parse9(char const *s)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	uint64_t w;
+
+	memcpy(&w, s + 1, sizeof(w));
+	w &= 0x0F * ONES;
+	w = (w * 10 + (w >> 8)) & UINT64_C(0x00FF00FF00FF00FF);
+	w = (w * 100 + (w >> 16)) & UINT64_C(0x0000FFFF0000FFFF);
+	w = (w * 10000 + (w >> 32)) & UINT64_C(0xFFFFFFFF);
+	return ((uint32_t)(s[0] - '0') * 100000000 + (uint32_t)w);
+#else
+	uint32_t v = 0;
+	int i;
+
+	for (i = 0; i < MUL_DIGITS; i++)
+		v = v * 10 + (uint32_t)(s[i] - '0');
+	return (v);
+#endif
+}
+
+
+/**
+ * mul_parse - Converts a string of decimal digits into limbs
+ *
+ * @r: Receives the limbs, room for MUL_LIMBS(len) of them
+ * @s: Digits, most significant first, already validated
+ * @len: Number of digits
+ *
+ * Return: The number of limbs of the value, leading zero limbs excluded
+ */
+size_t mul_parse(uint32_t *r, char const *s, size_t len)
+{
+	size_t n = 0, end, i;
+	uint32_t v;
+
+	for (end = len; end >= MUL_DIGITS; end -= MUL_DIGITS)
+		r[n++] = parse9(s + end - MUL_DIGITS);
+	if (end > 0)
+	{
+		for (v = 0, i = 0; i < end; i++)
+			v = v * 10 + (uint32_t)(s[i] - '0');
+		r[n++] = v;
+	}
+	return (mul_norm(r, n));
+}
+
+
+/**
+ * put9 - Writes a limb as exactly 9 digits
+ *
+ * @p: Receives the digits, leading zeros included
+ * @v: Limb
+ */
+static void put9(char *p, uint32_t v)
+{
+	p[0] = (char)('0' + v / 100000000);
+	v %= 100000000;
+	memcpy(p + 1, pairs + 2 * (v / 1000000), 2);
+	memcpy(p + 3, pairs + 2 * (v / 10000 % 100), 2);
+	memcpy(p + 5, pairs + 2 * (v / 100 % 100), 2);
+	memcpy(p + 7, pairs + 2 * (v % 100), 2);
+}
+
+
+/**
+ * mul_to_string - Writes a number in decimal
+ *
+ * Every limb below the top one becomes exactly 9 digits, written two at
+ * a time from a table of the 100 pairs of digits. Base 10^9 limbs need
+ * no radix conversion, so the output is linear in the number of digits.
+ *
+ * @out: Receives the digits, room for MUL_DIGITS * n characters, at
+ * least 1, not NUL-terminated
+ * @r: Limbs of the number
+ * @n: Number of limbs, leading zero limbs are skipped
+ *
+ * Return: The number of characters written
+ */
+size_t mul_to_string(char *out, const uint32_t *r, size_t n)
+{
+	char top[MUL_DIGITS];
+	size_t skip = 0, len;
+
+	n = mul_norm(r, n);
+	if (n == 0)
+	{
+		*out = '0';
+		return (1);
+	}
+	put9(top, r[--n]);
+	while (top[skip] == '0')
+		skip++;
+	len = MUL_DIGITS - skip;
+	memcpy(out, top + skip, len);
+	while (n > 0)
+	{
+		put9(out + len, r[--n]);
+		len += MUL_DIGITS;
+	}
+	return (len);
+}
@@ -0,0 +1,34 @@
+#include "mul.h"
+
+
+/**
+ * mul_karatsuba - Multiplies two numbers with one level of Karatsuba
+ *
+ * With a = a1.B^h + a0 and b = b1.B^h + b0, the product is
+ * z2.B^2h + z1.B^h + z0 where z0 = a0.b0, z2 = a1.b1 and
+ * z1 = (a0 + a1)(b0 + b1) - z0 - z2: three half-size products instead
+ * of four. The three products go through mul_limbs, which recurses
+ * until the operands are small enough for the schoolbook method.
+ *
+ * @r: Receives the na + nb limbs of the product, must not overlap a or b
+ * @a: First number
+ * @na: Number of limbs of @a
+ * @b: Second number
+ * @nb: Number of limbs of @b, (na + 1) / 2 < nb <= na
+ * @scratch: Temporary limbs, mul_scratch_size(na, nb) of them
+ */
+void mul_karatsuba(uint32_t *r, const uint32_t *a, size_t na,
+		   const uint32_t *b, size_t nb, uint32_t *scratch)
+{
+	size_t h = (na + 1) / 2, top = na + nb - h;
+	uint32_t *sa = scratch, *sb = sa + h + 1, *z1 = sb + h + 1;
+
+	mul_limbs(r, a, h, b, h, scratch);
+	mul_limbs(r + 2 * h, a + h, na - h, b + h, nb - h, scratch);
+	sa[h] = mul_add(sa, a, h, a + h, na - h);
+	sb[h] = mul_add(sb, b, h, b + h, nb - h);
+	mul_limbs(z1, sa, h + 1, sb, h + 1, z1 + 2 * h + 2);
+	mul_sub(z1, z1, 2 * h + 2, r, 2 * h);
+	mul_sub(z1, z1, 2 * h + 2, r + 2 * h, na + nb - 2 * h);
+	mul_add(r + h, r + h, top, z1, top < 2 * h + 2 ? top : 2 * h + 2);
+}
@@ -0,0 +1,72 @@
+#include "mul.h"
+
+
+/**
+ * mul_norm - Drops the leading zero limbs of a number
+ *
+ * @r: Limbs of the number
+ * @n: Number of limbs
+ *
+ * Return: The number of significant limbs, 0 if the number is zero
+ */
+size_t mul_norm(const uint32_t *r, size_t n)
+{
+	while (n > 0 && r[n - 1] == 0)
+		n--;
+	return (n);
+}
+
+
+/**
+ * mul_add - Adds two numbers
+ *
+ * @r: Receives the na limbs of the sum, may be @a or @b
+ * @a: First number
+ * @na: Number of limbs of @a
+ * @b: Second number
+ * @nb: Number of limbs of @b, at most na
+ *
+ * Return: The carry out of the top limb, 0 or 1
+ */
+uint32_t mul_add(uint32_t *r, const uint32_t *a, size_t na,
+		 const uint32_t *b, size_t nb)
+{
+	uint32_t carry = 0, v;
+	size_t i;
+
+	for (i = 0; i < na; i++)
+	{
+		v = a[i] + carry + (i < nb ? b[i] : 0);
+		carry = v >= MUL_BASE;
+		r[i] = carry ? v - MUL_BASE : v;
+	}
+	return (carry);
+}
+
+
+/**
+ * mul_sub - Subtracts a number from another one
+ *
+ * @r: Receives the na limbs of the difference, may be @a or @b
+ * @a: Number to subtract from
+ * @na: Number of limbs of @a
+ * @b: Number to subtract
+ * @nb: Number of limbs of @b, at most na
+ *
+ * Return: The borrow out of the top limb, 1 if b was greater than a
+ */
+uint32_t mul_sub(uint32_t *r, const uint32_t *a, size_t na,
+		 const uint32_t *b, size_t nb)
+{
+	uint32_t borrow = 0, v, d;
+	size_t i;
+
+	for (i = 0; i < na; i++)
+	{
+		d = borrow + (i < nb ? b[i] : 0);
+		borrow = a[i] < d;
+		v = a[i] - d;
+		r[i] = borrow ? v + MUL_BASE : v;
+	}
+	return (borrow);
+}
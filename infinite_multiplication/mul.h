@@ -0,0 +1,168 @@
+#ifndef MUL_H
+#define MUL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Numbers are stored as arrays of limbs, least significant first, each
+ * limb holding 9 decimal digits (a digit in base 10^9).
+ */
+#define MUL_BASE 1000000000U
+#define MUL_DIGITS 9
+#define MUL_LIMBS(len) (((len) + MUL_DIGITS - 1) / MUL_DIGITS)
+
+/*
+ * Limb products summed in a uint64_t before being split into a limb and
+ * a carry: 18 * (10^9 - 1)^2 still fits in 64 bits.
+ */
+#define MUL_FOLD 16
+
+/*
+ * Operands of at least this many limbs (both of them) are multiplied with
+ * Karatsuba, smaller ones with the schoolbook method.
+ */
+#ifndef MUL_KARATSUBA_MIN
+#define MUL_KARATSUBA_MIN 64
+#endif
+
+/* Below 4 limbs, the h + 1 limbs of a Karatsuba half are not shorter */
+#if MUL_KARATSUBA_MIN < 4
+#error "MUL_KARATSUBA_MIN must be at least 4"
+#endif
+
+/*
+ * Operands of at least this many limbs (both of them) are multiplied with
+ * a number-theoretic transform: each limb is cut into 3 coefficients in
+ * base 1000, convolved modulo two NTT primes (generator 3), and the exact
+ * coefficients are recombined with the Chinese remainder theorem.
+ */
+#ifndef MUL_NTT_MIN
+#define MUL_NTT_MIN 12000
+#endif
+
+/*
+ * Smallest block of the longer operand given to a thread by
+ * mul_limbs_parallel.
+ */
+#ifndef MUL_PARALLEL_MIN
+#define MUL_PARALLEL_MIN 512
+#endif
+
+#define MUL_NTT_P1 167772161U
+#define MUL_NTT_P2 469762049U
+#define MUL_NTT_P1_INV 104391568U
+#define MUL_NTT_G 3U
+#define MUL_NTT_MAX_LEN ((size_t)1 << 25)
+#define MUL_NTT_SCRATCH(len) (4 * (len))
+
+/**
+ * struct mul_prime_s - NTT prime, with its Montgomery constants
+ *
+ * @p: The prime
+ * @ninv: -1 / p modulo 2^32
+ * @r2: 2^64 modulo p, converts a residue to Montgomery form
+ */
+struct mul_prime_s
+{
+	uint32_t p;
+	uint32_t ninv;
+	uint32_t r2;
+};
+
+typedef struct mul_prime_s mul_prime_t;
+
+/*
+ * Every block handed out by an arena starts on this boundary; sizes are
+ * rounded up to it.
+ */
+#define MUL_ARENA_ALIGN 8
+#define MUL_ARENA_ROUND(size) \
+	(((size) + MUL_ARENA_ALIGN - 1) & ~(size_t)(MUL_ARENA_ALIGN - 1))
+
+/**
+ * struct mul_arena_s - Caller-supplied memory the library allocates from
+ *
+ * Blocks are handed out in order and never freed one by one: saving
+ * @used and restoring it later releases every block handed out since.
+ *
+ * @base: First byte of the arena, aligned on MUL_ARENA_ALIGN
+ * @size: Number of bytes of the arena
+ * @used: Number of bytes handed out
+ */
+struct mul_arena_s
+{
+	unsigned char *base;
+	size_t size;
+	size_t used;
+};
+
+typedef struct mul_arena_s mul_arena_t;
+
+/**
+ * struct mul_num_s - Non-negative number of the library API
+ *
+ * @limbs: Limbs, least significant first, held by an arena
+ * @n: Number of limbs, without leading zero limbs: 0 for zero
+ */
+struct mul_num_s
+{
+	uint32_t *limbs;
+	size_t n;
+};
+
+typedef struct mul_num_s mul_num_t;
+
+int is_number(const char *num);
+void print_result(const uint32_t *r, size_t n);
+void multiply_big_numbers(const char *num1, const char *num2);
+void infinite(int ac, char **av);
+
+int mul_is_digits(char const *s, size_t len);
+size_t mul_parse(uint32_t *r, char const *s, size_t len);
+size_t mul_to_string(char *out, const uint32_t *r, size_t n);
+size_t mul_norm(const uint32_t *r, size_t n);
+uint32_t mul_add(uint32_t *r, const uint32_t *a, size_t na,
+		 const uint32_t *b, size_t nb);
+uint32_t mul_sub(uint32_t *r, const uint32_t *a, size_t na,
+		 const uint32_t *b, size_t nb);
+void mul_basecase(uint32_t *r, const uint32_t *a, size_t na,
+		  const uint32_t *b, size_t nb);
+void mul_karatsuba(uint32_t *r, const uint32_t *a, size_t na,
+		   const uint32_t *b, size_t nb, uint32_t *scratch);
+void mul_limbs(uint32_t *r, const uint32_t *a, size_t na,
+	       const uint32_t *b, size_t nb, uint32_t *scratch);
+size_t mul_scratch_size(size_t na, size_t nb);
+void mul_sqr_basecase(uint32_t *r, const uint32_t *a, size_t n);
+void mul_sqr_karatsuba(uint32_t *r, const uint32_t *a, size_t n,
+		       uint32_t *scratch);
+void mul_sqr(uint32_t *r, const uint32_t *a, size_t n, uint32_t *scratch);
+int mul_limbs_alloc(uint32_t *r, const uint32_t *a, size_t na,
+		    const uint32_t *b, size_t nb);
+int mul_limbs_parallel(uint32_t *r, const uint32_t *a, size_t na,
+		       const uint32_t *b, size_t nb, int nthreads);
+int mul_sqr_parallel(uint32_t *r, const uint32_t *a, size_t n,
+		     size_t nthreads);
+
+size_t mul_ntt_len(size_t na, size_t nb);
+void mul_ntt(uint32_t *r, const uint32_t *a, size_t na,
+	     const uint32_t *b, size_t nb, uint32_t *scratch);
+void mul_ntt_conv(const mul_prime_t *pr, uint32_t *x, uint32_t *y,
+		  size_t n, uint32_t *roots);
+
+void mul_arena_init(mul_arena_t *ar, void *mem, size_t size);
+void *mul_arena_alloc(mul_arena_t *ar, size_t size);
+size_t mul_num_mul_size(size_t na, size_t nb);
+
+int mul_num_parse(mul_num_t *x, char const *s, size_t len, mul_arena_t *ar);
+int mul_num_mul(mul_num_t *r, const mul_num_t *a, const mul_num_t *b,
+		mul_arena_t *ar);
+int mul_num_square(mul_num_t *r, const mul_num_t *a, mul_arena_t *ar);
+int mul_num_cmp(const mul_num_t *a, const mul_num_t *b);
+char *mul_num_to_string(const mul_num_t *x, mul_arena_t *ar);
+int mul_num_add(mul_num_t *r, const mul_num_t *a, const mul_num_t *b,
+		mul_arena_t *ar);
+int mul_num_sub(mul_num_t *r, const mul_num_t *a, const mul_num_t *b,
+		mul_arena_t *ar);
+
+#endif /* MUL_H */
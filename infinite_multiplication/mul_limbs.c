@@ -0,0 +1,122 @@
+#include <stdlib.h>
+#include "mul.h"
+
+
+/**
+ * mul_unbalanced - Multiplies a number by a much shorter one
+ *
+ * The longer number is cut into pieces as long as the shorter one, each
+ * piece is multiplied on its own and added at its offset.
+ *
+ * @r: Receives the na + nb limbs of the product, must not overlap a or b
+ * @a: Longer number
+ * @na: Number of limbs of @a
+ * @b: Shorter number
+ * @nb: Number of limbs of @b, nb <= (na + 1) / 2
+ * @scratch: Temporary limbs, mul_scratch_size(na, nb) of them
+ */
+static void mul_unbalanced(uint32_t *r, const uint32_t *a, size_t na,
+			   const uint32_t *b, size_t nb, uint32_t *scratch)
+{
+	uint32_t *tmp = scratch;
+	size_t off, len;
+
+	mul_limbs(r, a, nb, b, nb, scratch);
+	for (off = nb; off < na; off += nb)
+	{
+		len = na - off < nb ? na - off : nb;
+		mul_limbs(tmp, a + off, len, b, nb, tmp + 2 * nb);
+		mul_add(r + off, tmp, len + nb, r + off, nb);
+	}
+}
+
+
+/**
+ * mul_limbs - Multiplies two numbers with the fastest method for their size
+ *
+ * A number multiplied by itself, same limbs and length, is squared with
+ * mul_sqr.
+ *
+ * @r: Receives the na + nb limbs of the product, must not overlap a or b
+ * @a: First number
+ * @na: Number of limbs of @a, at least 1
+ * @b: Second number
+ * @nb: Number of limbs of @b, at least 1
+ * @scratch: Temporary limbs, mul_scratch_size(na, nb) of them
+ */
+void mul_limbs(uint32_t *r, const uint32_t *a, size_t na,
+	       const uint32_t *b, size_t nb, uint32_t *scratch)
+{
+	if (na < nb)
+	{
+		mul_limbs(r, b, nb, a, na, scratch);
+		return;
+	}
+	if (a == b && na == nb)
+		mul_sqr(r, a, na, scratch);
+	else if (nb < MUL_KARATSUBA_MIN)
+		mul_basecase(r, a, na, b, nb);
+	else if (nb >= MUL_NTT_MIN && mul_ntt_len(na, na))
+		mul_ntt(r, a, na, b, nb, scratch);
+	else if (nb <= (na + 1) / 2)
+		mul_unbalanced(r, a, na, b, nb, scratch);
+	else
+		mul_karatsuba(r, a, na, b, nb, scratch);
+}
+
+
+/**
+ * mul_scratch_size - Computes the temporary limbs needed by mul_limbs
+ *
+ * Each level of Karatsuba on n limbs keeps 4 (h + 1) limbs, h = (n + 1)
+ * / 2, while its middle product of h + 1 limbs recurses; any level may
+ * instead hand its product to the NTT. The bound only grows with n, so
+ * it also covers the smaller products of a level and the pieces of an
+ * unbalanced product.
+ *
+ * @na: Number of limbs of the first number
+ * @nb: Number of limbs of the second number
+ *
+ * Return: The number of limbs to allocate, 0 if none are needed
+ */
+size_t mul_scratch_size(size_t na, size_t nb)
+{
+	size_t n = na > nb ? na : nb, size = 0, best = 0, len, h;
+
+	if (na < MUL_KARATSUBA_MIN || nb < MUL_KARATSUBA_MIN)
+		return (0);
+	for (; n >= MUL_KARATSUBA_MIN; n = h + 1)
+	{
+		len = n >= MUL_NTT_MIN ? mul_ntt_len(n, n) : 0;
+		if (len && size + MUL_NTT_SCRATCH(len) > best)
+			best = size + MUL_NTT_SCRATCH(len);
+		h = (n + 1) / 2;
+		size += 4 * (h + 1);
+	}
+	return (size > best ? size : best);
+}
+
+
+/**
+ * mul_limbs_alloc - Multiplies two numbers with scratch limbs of its own
+ *
+ * @r: Receives the na + nb limbs of the product, must not overlap a or b
+ * @a: First number
+ * @na: Number of limbs of @a, at least 1
+ * @b: Second number
+ * @nb: Number of limbs of @b, at least 1
+ *
+ * Return: 0 on success, -1 on failure
+ */
+int mul_limbs_alloc(uint32_t *r, const uint32_t *a, size_t na,
+		    const uint32_t *b, size_t nb)
+{
+	uint32_t *scratch = malloc(sizeof(*scratch) *
+				   (mul_scratch_size(na, nb) + 1));
+
+	if (!scratch)
+		return (-1);
+	mul_limbs(r, a, na, b, nb, scratch);
+	free(scratch);
+	return (0);
+}
@@ -0,0 +1,153 @@
+#include "mul.h"
+
+
+/**
+ * mont_mul - Multiplies two residues in Montgomery form
+ *
+ * @pr: Prime
+ * @a: First residue, times 2^32
+ * @b: Second residue
+ *
+ * Return: a * b / 2^32 modulo p, with no division
+ */
+static uint32_t mont_mul(const mul_prime_t *pr, uint32_t a, uint32_t b)
+{
+	uint64_t t = (uint64_t)a * b;
+	uint32_t m = (uint32_t)t * pr->ninv;
+	uint32_t u = (uint32_t)((t + (uint64_t)m * pr->p) >> 32);
+
+	return (u >= pr->p ? u - pr->p : u);
+}
+
+
+/**
+ * ntt_roots - Computes the roots of unity of every stage of a transform
+ *
+ * The stage combining blocks of m uses roots[m .. 2m - 1], the powers of
+ * a primitive 2m-th root, so each stage reads its roots in order.
+ *
+ * @pr: Prime
+ * @roots: Receives the n - 1 roots in Montgomery form, from index 1
+ * @n: Transform length, a power of 2 dividing p - 1
+ */
+static void ntt_roots(const mul_prime_t *pr, uint32_t *roots, size_t n)
+{
+	uint32_t base = mont_mul(pr, MUL_NTT_G, pr->r2);
+	uint32_t w = mont_mul(pr, 1, pr->r2), e;
+	size_t k, m = n / 2;
+
+	roots[m] = w;
+	for (e = (pr->p - 1) / (uint32_t)n; e; e >>= 1)
+	{
+		if (e & 1)
+			w = mont_mul(pr, w, base);
+		base = mont_mul(pr, base, base);
+	}
+	for (k = 1; k < m; k++)
+		roots[m + k] = mont_mul(pr, roots[m + k - 1], w);
+	for (m /= 2; m > 0; m /= 2)
+		for (k = 0; k < m; k++)
+			roots[m + k] = roots[2 * m + 2 * k];
+}
+
+
+/**
+ * bit_reverse - Puts the elements of an array in bit-reversed order
+ *
+ * @a: Array
+ * @n: Number of elements, a power of 2
+ */
+static void bit_reverse(uint32_t *a, size_t n)
+{
+	size_t i, j = 0, bit;
+	uint32_t tmp;
+
+	for (i = 1; i < n; i++)
+	{
+		for (bit = n >> 1; j & bit; bit >>= 1)
+			j ^= bit;
+		j |= bit;
+		if (i < j)
+		{
+			tmp = a[i];
+			a[i] = a[j];
+			a[j] = tmp;
+		}
+	}
+}
+
+
+/**
+ * transform - Computes the forward NTT of an array in place
+ *
+ * Works on a local copy of the prime: the compiler then knows the writes
+ * to @a cannot change it and keeps its constants in registers.
+ *
+ * @pr: Prime
+ * @a: Residues in Montgomery form
+ * @n: Transform length, a power of 2
+ * @roots: Roots of unity of every stage, from ntt_roots
+ */
+static void transform(const mul_prime_t *pr, uint32_t *a, size_t n,
+		      const uint32_t *roots)
+{
+	mul_prime_t q = *pr;
+	size_t m, i, j;
+	uint32_t u, v, p = q.p;
+
+	bit_reverse(a, n);
+	for (m = 1; m < n; m *= 2)
+	{
+		for (i = 0; i < n; i += 2 * m)
+			for (j = 0; j < m; j++)
+			{
+				u = a[i + j];
+				v = mont_mul(&q, a[i + j + m], roots[m + j]);
+				a[i + j] = u + v >= p ? u + v - p : u + v;
+				a[i + j + m] = u >= v ? u - v : u + p - v;
+			}
+	}
+}
+
+
+/**
+ * mul_ntt_conv - Computes the cyclic convolution of two arrays modulo p
+ *
+ * The inverse transform is the forward one read backwards, divided by n.
+ *
+ * @pr: Prime
+ * @x: First array of residues, receives the convolution
+ * @y: Second array of residues, overwritten, or NULL to convolve @x with
+ * itself, one forward transform instead of two
+ * @n: Length of both arrays, a power of 2 dividing p - 1
+ * @roots: Room for n residues
+ */
+void mul_ntt_conv(const mul_prime_t *pr, uint32_t *x, uint32_t *y,
+		  size_t n, uint32_t *roots)
+{
+	mul_prime_t q = *pr;
+	uint32_t scale = q.p - (q.p - 1) / (uint32_t)n, tmp;
+	size_t i;
+
+	ntt_roots(&q, roots, n);
+	for (i = 0; i < n; i++)
+		x[i] = mont_mul(&q, x[i], q.r2);
+	transform(&q, x, n, roots);
+	if (y)
+	{
+		for (i = 0; i < n; i++)
+			y[i] = mont_mul(&q, y[i], q.r2);
+		transform(&q, y, n, roots);
+	}
+	for (i = 0; i < n; i++)
+		x[i] = mont_mul(&q, x[i], y ? y[i] : x[i]);
+	transform(&q, x, n, roots);
+	for (i = 1; i < n - i; i++)
+	{
+		tmp = x[i];
+		x[i] = x[n - i];
+		x[n - i] = tmp;
+	}
+	for (i = 0; i < n; i++)
+		x[i] = mont_mul(&q, x[i], scale);
+}
@@ -0,0 +1,138 @@
+#include <string.h>
+#include "mul.h"
+
+
+/**
+ * prime_init - Computes the Montgomery constants of an NTT prime
+ *
+ * @pr: Receives the prime and its constants
+ * @p: Odd prime below 2^30
+ */
+static void prime_init(mul_prime_t *pr, uint32_t p)
+{
+	uint32_t inv = p;
+	uint64_t r = ((uint64_t)1 << 32) % p;
+	int i;
+
+	for (i = 0; i < 4; i++)
+		inv *= 2 - p * inv;
+	pr->p = p;
+	pr->ninv = 0U - inv;
+	pr->r2 = (uint32_t)(r * r % p);
+}
+
+
+/**
+ * load_coeffs - Cuts a number into coefficients in base 1000
+ *
+ * @x: Receives the n coefficients, zero-padded
+ * @a: Number
+ * @na: Number of limbs of @a, at most n / 3
+ * @n: Transform length
+ */
+static void load_coeffs(uint32_t *x, const uint32_t *a, size_t na,
+			size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < na; i++)
+	{
+		x[3 * i] = a[i] % 1000;
+		x[3 * i + 1] = a[i] / 1000 % 1000;
+		x[3 * i + 2] = a[i] / 1000000;
+	}
+	memset(x + 3 * na, 0, sizeof(*x) * (n - 3 * na));
+}
+
+
+/**
+ * crt_carry - Recombines the convolutions into the limbs of the product
+ *
+ * Each coefficient is below 3.min(na, nb).999^2, less than p1.p2, so the
+ * Chinese remainder theorem gives it exactly.
+ *
+ * @r: Receives the nr limbs of the product
+ * @nr: Number of limbs of the product
+ * @x1: Convolution modulo p1
+ * @x2: Convolution modulo p2
+ */
+static void crt_carry(uint32_t *r, size_t nr, const uint32_t *x1,
+		      const uint32_t *x2)
+{
+	uint64_t carry = 0, v, t;
+	uint32_t d[3];
+	size_t i, k, j;
+
+	for (i = 0; i < nr; i++)
+	{
+		for (k = 0, j = 3 * i; k < 3; k++, j++)
+		{
+			t = (x2[j] + MUL_NTT_P2 - x1[j]) % MUL_NTT_P2;
+			t = t * MUL_NTT_P1_INV % MUL_NTT_P2;
+			v = x1[j] + t * MUL_NTT_P1 + carry;
+			d[k] = (uint32_t)(v % 1000);
+			carry = v / 1000;
+		}
+		r[i] = d[0] + 1000 * d[1] + 1000000 * d[2];
+	}
+}
+
+
+/**
+ * mul_ntt_len - Computes the transform length of a product
+ *
+ * @na: Number of limbs of the first number
+ * @nb: Number of limbs of the second number
+ *
+ * Return: The smallest power of 2 holding the 3 (na + nb) coefficients of
+ * the product, 0 if it exceeds MUL_NTT_MAX_LEN
+ */
+size_t mul_ntt_len(size_t na, size_t nb)
+{
+	size_t n = 2;
+
+	while (n < 3 * (na + nb))
+	{
+		if (n >= MUL_NTT_MAX_LEN)
+			return (0);
+		n *= 2;
+	}
+	return (n);
+}
+
+
+/**
+ * mul_ntt - Multiplies two numbers with number-theoretic transforms
+ *
+ * O(n log n). The product is convolved modulo both primes then
+ * recombined, so it is exact. A square, b the same limbs as a, takes
+ * two transforms per prime instead of three.
+ *
+ * @r: Receives the na + nb limbs of the product, must not overlap a or b
+ * @a: First number
+ * @na: Number of limbs of @a
+ * @b: Second number
+ * @nb: Number of limbs of @b, mul_ntt_len(na, nb) must not be 0
+ * @scratch: Temporary limbs, MUL_NTT_SCRATCH(mul_ntt_len(na, nb))
+ */
+void mul_ntt(uint32_t *r, const uint32_t *a, size_t na,
+	     const uint32_t *b, size_t nb, uint32_t *scratch)
+{
+	size_t n = mul_ntt_len(na, nb);
+	uint32_t *x1 = scratch, *x2 = x1 + n, *y = x2 + n, *roots = y + n;
+	mul_prime_t pr;
+
+	if (a == b && na == nb)
+		y = NULL;
+	prime_init(&pr, MUL_NTT_P1);
+	load_coeffs(x1, a, na, n);
+	if (y)
+		load_coeffs(y, b, nb, n);
+	mul_ntt_conv(&pr, x1, y, n, roots);
+	prime_init(&pr, MUL_NTT_P2);
+	load_coeffs(x2, a, na, n);
+	if (y)
+		load_coeffs(y, b, nb, n);
+	mul_ntt_conv(&pr, x2, y, n, roots);
+	crt_carry(r, na + nb, x1, x2);
+}
@@ -0,0 +1,170 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "parallel.h"
+
+
+/**
+ * segment_run - Thread routine summing one segment of the product
+ *
+ * Adds the limbs of every block product overlapping the segment, keeping
+ * the carry out of the segment aside instead of propagating it, then
+ * records which carry in would overflow the summed segment.
+ *
+ * @arg: Part, as a mul_part_t
+ *
+ * Return: Always NULL
+ */
+static void *segment_run(void *arg)
+{
+	mul_part_t *part = arg;
+	const mul_part_t *p;
+	uint32_t *r = part->r;
+	size_t i, x, y;
+
+	memset(r + part->lo, 0, sizeof(*r) * (part->hi - part->lo));
+	part->carry = 0;
+	for (i = 0; i < part->nparts; i++)
+	{
+		p = part->parts + i;
+		x = p->off > part->lo ? p->off : part->lo;
+		y = p->off + p->len + p->nb;
+		y = y < part->hi ? y : part->hi;
+		if (x < y)
+			part->carry += mul_add(r + x, r + x, part->hi - x,
+					       p->prod + (x - p->off), y - x);
+	}
+	for (i = part->hi - 1; i > part->lo && r[i] == MUL_BASE - 1; i--)
+		;
+	part->need = i == part->lo ? MUL_BASE - r[i] : 0;
+	return (NULL);
+}
+
+
+/**
+ * carry_run - Thread routine adding the carry in of one segment
+ *
+ * The carry stops at the end of the segment: what overflows it is
+ * already part of the next segment's carry in.
+ *
+ * @arg: Part, as a mul_part_t
+ *
+ * Return: Always NULL
+ */
+static void *carry_run(void *arg)
+{
+	mul_part_t *part = arg;
+	uint32_t c = part->cin;
+	size_t k;
+
+	for (k = part->lo; c && k < part->hi; k++)
+	{
+		c += part->r[k];
+		part->r[k] = c % MUL_BASE;
+		c /= MUL_BASE;
+	}
+	return (NULL);
+}
+
+
+/**
+ * split_parts - Lays out the blocks, buffers and segments of the parts
+ *
+ * @parts: Parts to fill, the first one holding the operands and product
+ * @nparts: Number of parts
+ * @na: Number of limbs of the longer operand
+ * @step: Number of limbs of every block but the last
+ * @mem: Room for the product and scratch limbs of every part
+ */
+static void split_parts(mul_part_t *parts, size_t nparts, size_t na,
+			size_t step, uint32_t *mem)
+{
+	size_t nb = parts->nb, i;
+
+	for (i = 0; i < nparts; i++)
+	{
+		parts[i] = parts[0];
+		parts[i].parts = parts;
+		parts[i].nparts = nparts;
+		parts[i].off = i * step;
+		parts[i].a += parts[i].off;
+		parts[i].len = i + 1 < nparts ? step : na - parts[i].off;
+		parts[i].prod = mem;
+		mem += parts[i].len + nb;
+		parts[i].scratch = mem;
+		mem += mul_scratch_size(step, nb);
+		parts[i].lo = (na + nb) * i / nparts;
+		parts[i].hi = (na + nb) * (i + 1) / nparts;
+	}
+}
+
+
+/**
+ * mul_limbs_parallel - Multiplies two numbers on a pool of threads
+ *
+ * The longer operand is split into one block per thread and each block
+ * is multiplied by the whole shorter operand. The block products are
+ * then summed with one product segment per thread. Carries between
+ * segments are resolved like a carry-lookahead adder: each segment tells
+ * its carry out and which carry in it would pass on, a prefix pass over
+ * the segments turns that into the carry into each one, and the threads
+ * add them in parallel. The product is the one mul_limbs computes.
+ * A number multiplied by itself is squared by mul_sqr_parallel instead.
+ *
+ * Splitting only pays below the NTT tier: a block times the whole
+ * shorter operand costs a transform nearly as long as the full product,
+ * so NTT-sized products are left to mul_limbs on the calling thread.
+ *
+ * @r: Receives the na + nb limbs of the product
+ * @a: First operand
+ * @na: Number of limbs of @a
+ * @b: Second operand
+ * @nb: Number of limbs of @b
+ * @nthreads: Number of threads, or 0 to use every online CPU
+ *
+ * Return: 0 on success, -1 on failure
+ */
+int mul_limbs_parallel(uint32_t *r, const uint32_t *a, size_t na,
+		       const uint32_t *b, size_t nb, int nthreads)
+{
+	mul_part_t *parts;
+	size_t nparts, step, i;
+	uint32_t *mem, c;
+
+	if (na < nb)
+		return (mul_limbs_parallel(r, b, nb, a, na, nthreads));
+	nparts = nthreads > 0 ? nthreads : sysconf(_SC_NPROCESSORS_ONLN);
+	if (a == b && na == nb)
+		return (mul_sqr_parallel(r, a, na, nparts));
+	if (nparts > na / MUL_PARALLEL_MIN)
+		nparts = na / MUL_PARALLEL_MIN;
+	if (nparts < 2 || (nb >= MUL_NTT_MIN && mul_ntt_len(na, na)))
+		return (mul_limbs_alloc(r, a, na, b, nb));
+	step = (na + nparts - 1) / nparts;
+	nparts = (na + step - 1) / step;
+	parts = malloc(sizeof(*parts) * nparts);
+	mem = malloc(sizeof(*mem) * nparts *
+		     (step + nb + mul_scratch_size(step, nb)));
+	if (!parts || !mem)
+	{
+		free(parts);
+		free(mem);
+		return (-1);
+	}
+	parts->a = a;
+	parts->b = b;
+	parts->nb = nb;
+	parts->r = r;
+	split_parts(parts, nparts, na, step, mem);
+	mul_run_parts(parts, nparts, mul_part_mul);
+	mul_run_parts(parts, nparts, segment_run);
+	for (i = 0, c = 0; i < nparts; i++)
+	{
+		parts[i].cin = c;
+		c = parts[i].carry + (parts[i].need && c >= parts[i].need);
+	}
+	mul_run_parts(parts, nparts, carry_run);
+	free(parts);
+	free(mem);
+	return (0);
+}
@@ -0,0 +1,56 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <pthread.h>
+#include "mul.h"
+
+/**
+ * struct mul_part_s - Block of the longer operand and segment of the
+ * product handled by one thread of mul_limbs_parallel
+ *
+ * @parts: Every part, read when summing a segment
+ * @nparts: Number of parts
+ * @off: Index of the block's first limb in the longer operand
+ * @a: First limb of the block
+ * @len: Number of limbs of the block
+ * @b: Shorter operand, whole
+ * @nb: Number of limbs of @b
+ * @prod: Receives the len + nb limbs of the block's product
+ * @scratch: Temporary limbs of the block's product
+ * @r: Product being summed
+ * @lo: First limb of the product segment summed by the thread
+ * @hi: Limb past the end of the segment, above @lo
+ * @carry: Carry out of the segment once summed
+ * @need: Smallest carry in that overflows the summed segment, or 0 if
+ * none can (some limb above the first one is not 10^9 - 1)
+ * @cin: Carry into the segment, once every segment is summed
+ * @tid: Thread working on the part
+ * @started: 1 if @tid was started, 0 if the work was done inline
+ */
+struct mul_part_s
+{
+	const struct mul_part_s *parts;
+	size_t nparts;
+	size_t off;
+	const uint32_t *a;
+	size_t len;
+	const uint32_t *b;
+	size_t nb;
+	uint32_t *prod;
+	uint32_t *scratch;
+	uint32_t *r;
+	size_t lo;
+	size_t hi;
+	uint32_t carry;
+	uint32_t need;
+	uint32_t cin;
+	pthread_t tid;
+	int started;
+};
+
+typedef struct mul_part_s mul_part_t;
+
+void *mul_part_mul(void *arg);
+void mul_run_parts(mul_part_t *parts, size_t nparts, void *(*fn)(void *));
+
+#endif /* PARALLEL_H */
@@ -0,0 +1,97 @@
+#include "mul.h"
+
+
+/**
+ * mul_sqr_basecase - Squares a number with the schoolbook method
+ *
+ * Column k of a square holds a[i].a[k - i] and a[k - i].a[i] for every
+ * i < k - i, plus a[k / 2]^2 when k is even: each cross product is
+ * computed once and doubled, about half the limb products of
+ * mul_basecase.
+ *
+ * @r: Receives the 2n limbs of the square, must not overlap a
+ * @a: Number to square
+ * @n: Number of limbs of @a, at least 1
+ */
+void mul_sqr_basecase(uint32_t *r, const uint32_t *a, size_t n)
+{
+	uint64_t carry = 0, sum, low;
+	size_t k, i, first, mid, stop;
+
+	for (k = 0; k + 1 < 2 * n; k++)
+	{
+		first = k < n ? 0 : k - n + 1;
+		mid = (k + 1) / 2;
+		low = carry % MUL_BASE;
+		carry /= MUL_BASE;
+		for (i = first; i < mid; )
+		{
+			stop = mid - i > MUL_FOLD ? i + MUL_FOLD : mid;
+			for (sum = 0; i < stop; i++)
+				sum += (uint64_t)a[i] * a[k - i];
+			low += 2 * (sum % MUL_BASE);
+			carry += 2 * (sum / MUL_BASE);
+		}
+		if (k % 2 == 0)
+		{
+			sum = (uint64_t)a[k / 2] * a[k / 2];
+			low += sum % MUL_BASE;
+			carry += sum / MUL_BASE;
+		}
+		r[k] = (uint32_t)(low % MUL_BASE);
+		carry += low / MUL_BASE;
+	}
+	r[2 * n - 1] = (uint32_t)carry;
+}
+
+
+/**
+ * mul_sqr_karatsuba - Squares a number with one level of Karatsuba
+ *
+ * With a = a1.B^h + a0, the square is z2.B^2h + z1.B^h + z0 where
+ * z0 = a0^2, z2 = a1^2 and z1 = (a0 + a1)^2 - z0 - z2: three half-size
+ * squares, each going through mul_sqr, and a single sum to keep.
+ *
+ * @r: Receives the 2n limbs of the square, must not overlap a
+ * @a: Number to square
+ * @n: Number of limbs of @a
+ * @scratch: Temporary limbs, mul_scratch_size(n, n) of them
+ */
+void mul_sqr_karatsuba(uint32_t *r, const uint32_t *a, size_t n,
+		       uint32_t *scratch)
+{
+	size_t h = (n + 1) / 2, top = 2 * n - h;
+	uint32_t *sa = scratch, *z1 = sa + h + 1;
+
+	mul_sqr(r, a, h, scratch);
+	mul_sqr(r + 2 * h, a + h, n - h, scratch);
+	sa[h] = mul_add(sa, a, h, a + h, n - h);
+	mul_sqr(z1, sa, h + 1, z1 + 2 * h + 2);
+	mul_sub(z1, z1, 2 * h + 2, r, 2 * h);
+	mul_sub(z1, z1, 2 * h + 2, r + 2 * h, 2 * n - 2 * h);
+	mul_add(r + h, r + h, top, z1, top < 2 * h + 2 ? top : 2 * h + 2);
+}
+
+
+/**
+ * mul_sqr - Squares a number with the fastest method for its size
+ *
+ * The same tiers as mul_limbs, each one sharing the work of the two
+ * identical operands: the schoolbook method computes each cross product
+ * once, Karatsuba keeps one sum instead of two, and the NTT transforms
+ * the operand once instead of twice.
+ *
+ * @r: Receives the 2n limbs of the square, must not overlap a
+ * @a: Number to square
+ * @n: Number of limbs of @a, at least 1
+ * @scratch: Temporary limbs, mul_scratch_size(n, n) of them
+ */
+void mul_sqr(uint32_t *r, const uint32_t *a, size_t n, uint32_t *scratch)
+{
+	if (n < MUL_KARATSUBA_MIN)
+		mul_sqr_basecase(r, a, n);
+	else if (n >= MUL_NTT_MIN && mul_ntt_len(n, n))
+		mul_ntt(r, a, n, a, n, scratch);
+	else
+		mul_sqr_karatsuba(r, a, n, scratch);
+}
@@ -0,0 +1,141 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include "mul.h"
+
+
+/**
+ * struct sqr_part_s - One of the three half-size squares of a Karatsuba
+ * level, and the threads it may use
+ *
+ * @r: Receives the 2n limbs of the square
+ * @a: Number to square
+ * @n: Number of limbs of @a
+ * @nthreads: Threads the square may use, its own included; 0 to square
+ * on the calling thread once the other parts are started
+ * @ret: 0 once squared, -1 if memory ran out
+ * @tid: Thread squaring the part
+ * @started: 1 if @tid was started, 0 if the part was squared inline
+ */
+struct sqr_part_s
+{
+	uint32_t *r;
+	const uint32_t *a;
+	size_t n;
+	size_t nthreads;
+	int ret;
+	pthread_t tid;
+	int started;
+};
+
+
+/**
+ * sqr_run - Thread routine squaring one part, splitting it again if it
+ * has threads to spare
+ *
+ * @arg: Part, as a struct sqr_part_s
+ *
+ * Return: Always NULL
+ */
+static void *sqr_run(void *arg)
+{
+	struct sqr_part_s *p = arg;
+
+	p->ret = mul_sqr_parallel(p->r, p->a, p->n,
+				  p->nthreads ? p->nthreads : 1);
+	return (NULL);
+}
+
+
+/**
+ * sqr_parts - Lays out the three squares of a Karatsuba level and shares
+ * the threads between them
+ *
+ * The calling thread squares a0 with a third of the threads; (a0 + a1),
+ * the longest, gets the most threads.
+ *
+ * @parts: Receives the squares of a0, a1 and a0 + a1
+ * @r: Receives a0^2 in its low 2h limbs, a1^2 above
+ * @a: Number to square
+ * @n: Number of limbs of @a
+ * @sa: Holds the h + 1 limbs of a0 + a1, then room for their square
+ * @nthreads: Threads to share, at least 2
+ */
+static void sqr_parts(struct sqr_part_s *parts, uint32_t *r,
+		      const uint32_t *a, size_t n, uint32_t *sa,
+		      size_t nthreads)
+{
+	size_t h = (n + 1) / 2;
+
+	parts[0].r = r;
+	parts[0].a = a;
+	parts[0].n = h;
+	parts[1].r = r + 2 * h;
+	parts[1].a = a + h;
+	parts[1].n = n - h;
+	parts[1].nthreads = nthreads / 3;
+	parts[2].r = sa + h + 1;
+	parts[2].a = sa;
+	parts[2].n = h + 1;
+	parts[2].nthreads = (nthreads + 2) / 3;
+	parts[0].nthreads = nthreads - parts[1].nthreads - parts[2].nthreads;
+}
+
+
+/**
+ * mul_sqr_parallel - Squares a number on a pool of threads
+ *
+ * Runs the top levels of mul_sqr_karatsuba in parallel: the three
+ * half-size squares are computed at once, each one split again while it
+ * has threads to spare, then combined as mul_sqr_karatsuba does. The
+ * square is the one mul_sqr computes.
+ *
+ * As for general products, a thread gets at least MUL_PARALLEL_MIN limbs
+ * and NTT-sized squares stay on the calling thread: three half-size
+ * transforms are half as much work again as the full one.
+ *
+ * @r: Receives the 2n limbs of the square, must not overlap a
+ * @a: Number to square
+ * @n: Number of limbs of @a, at least 1
+ * @nthreads: Number of threads, the calling one included; no more than
+ * n / MUL_PARALLEL_MIN are used
+ *
+ * Return: 0 on success, -1 on failure
+ */
+int mul_sqr_parallel(uint32_t *r, const uint32_t *a, size_t n,
+		     size_t nthreads)
+{
+	struct sqr_part_s parts[3];
+	size_t h = (n + 1) / 2, top = 2 * n - h, i;
+	uint32_t *sa, *z1;
+
+	if (nthreads > n / MUL_PARALLEL_MIN)
+		nthreads = n / MUL_PARALLEL_MIN;
+	if (nthreads < 2 || (n >= MUL_NTT_MIN && mul_ntt_len(n, n)))
+		return (mul_limbs_alloc(r, a, n, a, n));
+	sa = malloc(sizeof(*sa) * (3 * h + 3));
+	if (!sa)
+		return (-1);
+	z1 = sa + h + 1;
+	sa[h] = mul_add(sa, a, h, a + h, n - h);
+	sqr_parts(parts, r, a, n, sa, nthreads);
+	for (i = 1; i < 3; i++)
+		parts[i].started = parts[i].nthreads &&
+			!pthread_create(&parts[i].tid, NULL, sqr_run,
+					parts + i);
+	sqr_run(parts);
+	for (i = 1; i < 3; i++)
+		if (parts[i].started)
+			pthread_join(parts[i].tid, NULL);
+		else
+			sqr_run(parts + i);
+	if (parts[0].ret || parts[1].ret || parts[2].ret)
+	{
+		free(sa);
+		return (-1);
+	}
+	mul_sub(z1, z1, 2 * h + 2, r, 2 * h);
+	mul_sub(z1, z1, 2 * h + 2, r + 2 * h, 2 * n - 2 * h);
+	mul_add(r + h, r + h, top, z1, top < 2 * h + 2 ? top : 2 * h + 2);
+	free(sa);
+	return (0);
+}
@@ -0,0 +1,45 @@
+#include "parallel.h"
+
+
+/**
+ * mul_part_mul - Thread routine multiplying one block by the shorter
+ * operand
+ *
+ * @arg: Part, as a mul_part_t
+ *
+ * Return: Always NULL
+ */
+void *mul_part_mul(void *arg)
+{
+	mul_part_t *part = arg;
+
+	mul_limbs(part->prod, part->a, part->len, part->b, part->nb,
+		  part->scratch);
+	return (NULL);
+}
+
+
+/**
+ * mul_run_parts - Runs a routine on every part, one thread each
+ *
+ * A part whose thread cannot be started runs inline instead.
+ *
+ * @parts: Parts to run
+ * @nparts: Number of parts
+ * @fn: Thread routine
+ */
+void mul_run_parts(mul_part_t *parts, size_t nparts, void *(*fn)(void *))
+{
+	size_t i;
+
+	for (i = 0; i < nparts; i++)
+	{
+		parts[i].started = !pthread_create(&parts[i].tid, NULL, fn,
+						   parts + i);
+		if (!parts[i].started)
+			fn(parts + i);
+	}
+	for (i = 0; i < nparts; i++)
+		if (parts[i].started)
+			pthread_join(parts[i].tid, NULL);
+}
@@ -0,0 +1,180 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "bench.h"
+
+
+/**
+ * now_ms - Reads the monotonic clock
+ *
+ * Return: The current time, in milliseconds
+ */
+static double now_ms(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e3 + ts.tv_nsec / 1e6);
+}
+
+
+/**
+ * time_point - Measures the mean time of one call of a matcher
+ *
+ * Doubles the number of calls until they take at least @min_ms.
+ *
+ * @f: Series being measured
+ * @s: Subject
+ * @p: Pattern
+ * @min_ms: Shortest measurement, in milliseconds
+ * @calls: Receives the number of calls measured
+ * @match: Receives the result of the matcher
+ *
+ * Return: The mean time of a call, in nanoseconds
+ */
+static double time_point(const bench_family_t *f, char *s, char *p,
+			 double min_ms, long *calls, int *match)
+{
+	double start, elapsed;
+	long i, n;
+
+	for (n = 1; ; n *= 2)
+	{
+		start = now_ms();
+		for (i = 0; i < n; i++)
+			*match = f->match(s, p);
+		elapsed = now_ms() - start;
+		if (elapsed >= min_ms)
+			break;
+	}
+	*calls = n;
+	return (elapsed * 1e6 / n);
+}
+
+
+/**
+ * run_series - Measures a matcher on a family at doubling sizes
+ *
+ * Prints one line per size. The scaling exponent is the log-log slope
+ * of the time per call between two consecutive sizes: about 1 for a
+ * linear matcher, 2 for a quadratic one. The series stops before a size
+ * whose call, predicted from the time per call and the exponent so far,
+ * would take max_ms or more.
+ *
+ * @f: Series to run
+ * @o: Settings of the run
+ * @s: Buffer of at least max_size + 1 bytes for the subject
+ *
+ * Return: 1 if the last exponent is above max_slope, 0 otherwise
+ */
+static int run_series(const bench_family_t *f, const bench_opts_t *o,
+		      char *s)
+{
+	char p[BENCH_PATTERN_MAX];
+	size_t n, prev_n = 0;
+	double ns, prev_ns = 0, slope = 0;
+	long calls;
+	int match;
+
+	for (n = o->min_size; n <= o->max_size; n *= 2)
+	{
+		f->build(s, p, n);
+		ns = time_point(f, s, p, o->min_ms, &calls, &match);
+		printf("%s\t%s\t%lu\t%lu\t%d\t%ld\t%.1f\t%.2f\t", f->matcher,
+		       f->name, (unsigned long)n, (unsigned long)strlen(p),
+		       match, calls, ns, n * 1e3 / ns);
+		if (prev_n)
+		{
+			slope = log(ns / prev_ns) / log((double)n / prev_n);
+			printf("%.2f\n", slope);
+		}
+		else
+			printf("-\n");
+		fflush(stdout);
+		prev_n = n;
+		prev_ns = ns;
+		if (ns * pow(2, slope > 1 ? slope : 1) / 1e6 >= o->max_ms)
+			break;
+	}
+	if (o->max_slope > 0 && slope > o->max_slope)
+	{
+		fprintf(stderr, "%s/%s: scaling exponent %.2f > %.2f\n",
+			f->matcher, f->name, slope, o->max_slope);
+		return (1);
+	}
+	return (0);
+}
+
+
+/**
+ * parse_opts - Reads the command line settings
+ *
+ * @argc: Number of arguments
+ * @argv: Arguments
+ * @o: Receives the settings, already holding the defaults
+ *
+ * Return: 0 on success, -1 on an invalid option
+ */
+static int parse_opts(int argc, char **argv, bench_opts_t *o)
+{
+	int c;
+
+	while ((c = getopt(argc, argv, "n:N:t:T:m:f:")) != -1)
+	{
+		if (c == 'n')
+			o->min_size = strtoul(optarg, NULL, 10);
+		else if (c == 'N')
+			o->max_size = strtoul(optarg, NULL, 10);
+		else if (c == 't')
+			o->min_ms = strtod(optarg, NULL);
+		else if (c == 'T')
+			o->max_ms = strtod(optarg, NULL);
+		else if (c == 'm')
+			o->max_slope = strtod(optarg, NULL);
+		else if (c == 'f')
+			o->only = optarg;
+		else
+			return (-1);
+	}
+	if (o->min_size == 0 || o->max_size < o->min_size || o->min_ms <= 0)
+		return (-1);
+	return (0);
+}
+
+
+/**
+ * main - Runs every series and prints the results as tab-separated values
+ *
+ * @argc: Number of arguments
+ * @argv: Arguments
+ *
+ * Return: 0 on success, 1 if a series scales above -m, 2 on bad usage
+ */
+int main(int argc, char **argv)
+{
+	bench_opts_t o = {16, 1 << 20, 20, 1000, 0, NULL};
+	const bench_family_t *f;
+	char *s;
+	int ret = 0;
+
+	if (parse_opts(argc, argv, &o) == -1)
+	{
+		fprintf(stderr, "Usage: %s [-n min_size] [-N max_size] [-t ms]"
+			" [-T max_ms] [-m max_slope] [-f filter]\n", argv[0]);
+		return (2);
+	}
+	s = malloc(o.max_size + 1);
+	if (!s)
+		return (2);
+	printf("matcher\tfamily\tsize\tpattern_len\tmatch\tcalls\t"
+	       "ns_per_call\tmb_per_s\tslope\n");
+	for (f = bench_families; f->name; f++)
+		if (!o.only || strstr(f->matcher, o.only) ||
+		    strstr(f->name, o.only))
+			ret |= run_series(f, &o, s);
+	free(s);
+	return (ret);
+}
@@ -0,0 +1,55 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stddef.h>
+
+#define BENCH_PATTERN_MAX 128
+
+/**
+ * struct bench_family_s - Family of adversarial inputs run by one matcher
+ *
+ * @matcher: Name of the matcher under test
+ * @name: Name of the family
+ * @build: Writes the subject of length n and the pattern of the family
+ * @match: Runs the matcher, returns its result
+ */
+struct bench_family_s
+{
+	char const *matcher;
+	char const *name;
+	void (*build)(char *s, char *p, size_t n);
+	int (*match)(char *s, char *p);
+};
+
+typedef struct bench_family_s bench_family_t;
+
+/**
+ * struct bench_opts_s - Settings of a benchmark run
+ *
+ * @min_size: Subject length of the first point of every series
+ * @max_size: Largest subject length, sizes double up to it
+ * @min_ms: Time spent measuring each point, in milliseconds
+ * @max_ms: A series stops before a size whose call is predicted to take
+ * this long
+ * @max_slope: Largest scaling exponent accepted at the end of a series
+ * @only: Only series whose matcher or family contains this, or NULL
+ */
+struct bench_opts_s
+{
+	size_t min_size;
+	size_t max_size;
+	double min_ms;
+	double max_ms;
+	double max_slope;
+	char const *only;
+};
+
+typedef struct bench_opts_s bench_opts_t;
+
+extern const bench_family_t bench_families[];
+
+int run_glob(char *s, char *p);
+int run_regex(char *s, char *p);
+int run_regex_raw(char *s, char *p);
+
+#endif /* BENCH_H */
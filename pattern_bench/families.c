@@ -0,0 +1,126 @@
+#include <string.h>
+#include "holberton.h"
+#include "bench.h"
+
+
+/**
+ * build_stars - Many stars that all have to give up: a^n against a*a*...b
+ *
+ * @s: Receives the subject, n bytes
+ * @p: Receives the glob pattern
+ * @n: Length of the subject
+ */
+static void build_stars(char *s, char *p, size_t n)
+{
+	memset(s, 'a', n);
+	s[n] = '\0';
+	strcpy(p, "*a*a*a*a*a*a*a*a*a*a*a*a*a*a*a*ab");
+}
+
+
+/**
+ * build_run - A long literal run that almost matches everywhere:
+ * a^n against *a...ab with 32 a's
+ *
+ * @s: Receives the subject, n bytes
+ * @p: Receives the glob pattern
+ * @n: Length of the subject
+ */
+static void build_run(char *s, char *p, size_t n)
+{
+	memset(s, 'a', n);
+	s[n] = '\0';
+	p[0] = '*';
+	memset(p + 1, 'a', 32);
+	strcpy(p + 33, "b");
+}
+
+
+/**
+ * build_near - Every literal but one is found, the end anchor matches:
+ * (ab)^(n/2) ending in c, against *ab*ab*ab*abd*c
+ *
+ * @s: Receives the subject, n bytes
+ * @p: Receives the glob pattern
+ * @n: Length of the subject
+ */
+static void build_near(char *s, char *p, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++)
+		s[i] = i % 2 ? 'b' : 'a';
+	if (n)
+		s[n - 1] = 'c';
+	s[n] = '\0';
+	strcpy(p, "*ab*ab*ab*abd*c");
+}
+
+
+/**
+ * build_repeat - The classic backtracking trap for regexes:
+ * a^(n-2)cb against a*a*...a*b, matched as a regex
+ *
+ * The subject ends in the pattern's only literal, so it gets past the
+ * literal prefilter and fails inside the NFA, at the c.
+ *
+ * @s: Receives the subject, n bytes
+ * @p: Receives the regex
+ * @n: Length of the subject
+ */
+static void build_repeat(char *s, char *p, size_t n)
+{
+	memset(s, 'a', n);
+	if (n >= 2)
+	{
+		s[n - 2] = 'c';
+		s[n - 1] = 'b';
+	}
+	s[n] = '\0';
+	strcpy(p, "a*a*a*a*a*a*a*a*a*a*a*a*a*a*a*a*b");
+}
+
+
+/**
+ * build_chain - Characters a fixed distance apart, tracked at every
+ * position: (aacc)^k ending in ab, against .*a.a.a.a.a.a.a.ab
+ *
+ * The subject holds every literal run in order, so it gets past the
+ * literal prefilter; the NFA keeps the whole chain alive to the last byte,
+ * where the a's two bytes apart never line up.
+ *
+ * @s: Receives the subject, n bytes
+ * @p: Receives the regex
+ * @n: Length of the subject
+ */
+static void build_chain(char *s, char *p, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++)
+		s[i] = i % 4 < 2 ? 'a' : 'c';
+	if (n >= 2)
+	{
+		s[n - 2] = 'a';
+		s[n - 1] = 'b';
+	}
+	s[n] = '\0';
+	strcpy(p, ".*a.a.a.a.a.a.a.ab");
+}
+
+
+/* Every series of the benchmark, in the order they are run */
+const bench_family_t bench_families[] = {
+	{"wildcmp", "stars", build_stars, wildcmp},
+	{"wildcmp", "run", build_run, wildcmp},
+	{"wildcmp", "near", build_near, wildcmp},
+	{"wildcmp_exec", "stars", build_stars, run_glob},
+	{"wildcmp_exec", "run", build_run, run_glob},
+	{"wildcmp_exec", "near", build_near, run_glob},
+	{"regex_match", "stars", build_stars, run_regex},
+	{"regex_match", "run", build_run, run_regex},
+	{"regex_match", "near", build_near, run_regex},
+	{"regex_match", "repeat", build_repeat, run_regex_raw},
+	{"regex_match", "chain", build_chain, run_regex_raw},
+	{NULL, NULL, NULL, NULL}
+};
@@ -0,0 +1,61 @@
+#include <string.h>
+#include "holberton.h"
+#include "regex.h"
+#include "bench.h"
+
+
+/**
+ * run_glob - Compiles then runs a glob pattern, compile time included
+ *
+ * @s: Subject
+ * @p: Glob pattern
+ *
+ * Return: 1 on a match, 0 otherwise
+ */
+int run_glob(char *s, char *p)
+{
+	wildcmp_prog_t *prog = wildcmp_compile(p);
+	int ret = wildcmp_exec(prog, s, strlen(s));
+
+	wildcmp_free(prog);
+	return (ret);
+}
+
+
+/**
+ * run_regex - Turns a glob pattern into a regex ('*' becomes ".*") and
+ * matches it with regex_match
+ *
+ * @s: Subject
+ * @p: Glob pattern
+ *
+ * Return: 1 on a match, 0 otherwise
+ */
+int run_regex(char *s, char *p)
+{
+	char re[2 * BENCH_PATTERN_MAX];
+	size_t i, j;
+
+	for (i = j = 0; p[i]; i++)
+	{
+		if (p[i] == '*')
+			re[j++] = '.';
+		re[j++] = p[i];
+	}
+	re[j] = '\0';
+	return (regex_match(s, re));
+}
+
+
+/**
+ * run_regex_raw - Matches a regex as is with regex_match
+ *
+ * @s: Subject
+ * @p: Regex
+ *
+ * Return: 1 on a match, 0 otherwise
+ */
+int run_regex_raw(char *s, char *p)
+{
+	return (regex_match(s, p));
+}
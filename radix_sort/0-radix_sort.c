@@ -14,8 +14,9 @@
 int getMax(int *array, size_t size)
 {
 	int mx = array[0];
+	size_t i;
 
-	for (size_t i = 1; i < size; i++)
+	for (i = 1; i < size; i++)
 		if (array[i] > mx)
 			mx = array[i];
 	return (mx);
@@ -28,25 +29,26 @@ int getMax(int *array, size_t size)
  * @array: The array to be printed
  * @size: Number of elements in @array
  * @exp: 10^i where i is the current
+ * @output: Scratch room for size elements
  */
-void countSort(int *array, size_t size, int exp)
+void countSort(int *array, size_t size, int exp, int *output)
 {
-	int output[size];
-	int count[10] = {0};
+	size_t count[10] = {0};
+	size_t i;
 
-	for (size_t i = 0; i < size; i++)
+	for (i = 0; i < size; i++)
 		count[(array[i] / exp) % 10]++;
 
-	for (int i = 1; i < 10; i++)
+	for (i = 1; i < 10; i++)
 		count[i] += count[i - 1];
 
-	for (int i = size - 1; i >= 0; i--)
+	for (i = size; i-- > 0; )
 	{
 		output[count[(array[i] / exp) % 10] - 1] = array[i];
 		count[(array[i] / exp) % 10]--;
 	}
 
-	for (size_t i = 0; i < size; i++)
+	for (i = 0; i < size; i++)
 		array[i] = output[i];
 	print_array(array, size);
 }
@@ -56,18 +58,29 @@ void countSort(int *array, size_t size, int exp)
  * radix_sort - Sorts an array of integers in ascending order
  * using the Radix sort algorithm.
  *
+ * The scratch room of the counting sorts is allocated once, on the heap;
+ * the array is left untouched if it cannot be.
+ *
  * @array: The array to be printed
  * @size: Number of elements in @array
  */
 void radix_sort(int *array, size_t size)
 {
+	int *output;
+	size_t exp;
+	int m;
+
 	if (size < 2)
 	{
 		return;
 	}
 
-	int m = getMax(array, size);
+	output = malloc(sizeof(*output) * size);
+	if (!output)
+		return;
+	m = getMax(array, size);
 
-	for (size_t exp = 1; m / exp > 0; exp *= 10)
-		countSort(array, size, exp);
+	for (exp = 1; m / exp > 0; exp *= 10)
+		countSort(array, size, exp, output);
+	free(output);
 }
@@ -0,0 +1,21 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "sort.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: Always 0
+ */
+int main(void)
+{
+    int array[] = {19, -48, 99, 71, -13, 52, 0, 73, -2147483647 - 1, 7};
+    size_t n = sizeof(array) / sizeof(array[0]);
+
+    print_array(array, n);
+    printf("\n");
+    if (radix_sort_bytes(array, n, NULL) == -1)
+        return (1);
+    print_array(array, n);
+    return (0);
+}
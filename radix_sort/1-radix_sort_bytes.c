@@ -0,0 +1,103 @@
+#include <stdlib.h>
+#include <string.h>
+#include "sort.h"
+
+
+/**
+ * build_histograms - Counts the values of every byte of every key
+ *
+ * One pass over the array fills the histograms of all four sorting
+ * passes at once.
+ *
+ * @array: Keys to count
+ * @size: Number of elements in @array
+ * @hist: Receives the counts, one histogram per byte, low byte first
+ */
+static void build_histograms(const int *array, size_t size,
+			     size_t hist[RADIX_PASSES][RADIX_BUCKETS])
+{
+	unsigned int key;
+	size_t i;
+
+	memset(hist, 0, sizeof(size_t) * RADIX_PASSES * RADIX_BUCKETS);
+	for (i = 0; i < size; i++)
+	{
+		key = RADIX_KEY(array[i]);
+		hist[0][key & 0xff]++;
+		hist[1][(key >> 8) & 0xff]++;
+		hist[2][(key >> 16) & 0xff]++;
+		hist[3][key >> 24]++;
+	}
+}
+
+
+/**
+ * scatter_pass - Stable counting sort of an array on one byte of its keys
+ *
+ * @src: Keys to sort
+ * @dst: Receives the sorted keys
+ * @size: Number of elements in @src
+ * @count: Histogram of the byte, turned into bucket offsets
+ * @shift: Position of the byte in the keys, in bits
+ */
+static void scatter_pass(const int *src, int *dst, size_t size,
+			 size_t *count, int shift)
+{
+	size_t i, sum = 0, c;
+
+	for (i = 0; i < RADIX_BUCKETS; i++)
+	{
+		c = count[i];
+		count[i] = sum;
+		sum += c;
+	}
+	for (i = 0; i < size; i++)
+		dst[count[(RADIX_KEY(src[i]) >> shift) & 0xff]++] = src[i];
+}
+
+
+/**
+ * radix_sort_bytes - Sorts an array of integers in ascending order
+ * using an LSD radix sort in base 256
+ *
+ * Four stable counting sorts, one per byte of the keys, with the sign bit
+ * flipped so that negative keys come first. The histograms of the four
+ * passes are built in a single pass over the array, and a pass whose
+ * byte is the same for every key is skipped. Nothing is printed.
+ *
+ * @array: The array to sort
+ * @size: Number of elements in @array
+ * @tmp: Scratch room for size elements, or NULL to allocate it
+ *
+ * Return: 0 on success, -1 if the scratch room cannot be allocated
+ */
+int radix_sort_bytes(int *array, size_t size, int *tmp)
+{
+	size_t hist[RADIX_PASSES][RADIX_BUCKETS];
+	int *src = array, *dst = tmp, *swap;
+	unsigned int first;
+	int pass;
+
+	if (!array || size < 2)
+		return (0);
+	if (!tmp)
+		dst = malloc(sizeof(*dst) * size);
+	if (!dst)
+		return (-1);
+	build_histograms(array, size, hist);
+	first = RADIX_KEY(array[0]);
+	for (pass = 0; pass < RADIX_PASSES; pass++)
+	{
+		if (hist[pass][(first >> (8 * pass)) & 0xff] == size)
+			continue;
+		scatter_pass(src, dst, size, hist[pass], 8 * pass);
+		swap = src;
+		src = dst;
+		dst = swap;
+	}
+	if (src != array)
+		memcpy(array, src, sizeof(*array) * size);
+	if (!tmp)
+		free(src == array ? dst : src);
+	return (0);
+}
@@ -3,7 +3,18 @@
 
 #include <stdio.h>
 
+/*
+ * Base 256 mode: one pass per byte of a 32-bit int, keys compared as
+ * unsigned with the sign bit flipped, so that negative values sort first.
+ */
+#define RADIX_PASSES 4
+#define RADIX_BUCKETS 256
+#define RADIX_KEY(x) ((unsigned int)(x) ^ 0x80000000U)
+
 void print_array(const int *array, size_t size);
+int getMax(int *array, size_t size);
+void countSort(int *array, size_t size, int exp, int *output);
 void radix_sort(int *array, size_t size);
+int radix_sort_bytes(int *array, size_t size, int *tmp);
 
 #endif /* _SORT_H_ */
@@ -0,0 +1,33 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "regex.h"
+
+/**
+ * main - Matches a few strings against a set of four patterns at once
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    char const *patterns[] = {"H.*", ".*n", "Holberton", "a*b"};
+    char const *strs[] = {"Holberton", "Hn", "aaab", "b", "Julien", ""};
+    regex_set_t *set = regex_set_compile(patterns, 4, 0);
+    unsigned char bits[1];
+    size_t i;
+    int n, k;
+
+    if (!set)
+        return (EXIT_FAILURE);
+    for (i = 0; i < sizeof(strs) / sizeof(*strs); i++)
+    {
+        n = regex_set_match(set, strs[i], bits);
+        printf("\"%s\" -> %d:", strs[i], n);
+        for (k = 0; k < 4; k++)
+            if (bits[0] >> k & 1)
+                printf(" %s", patterns[k]);
+        printf("\n");
+    }
+    regex_set_free(set);
+    return (EXIT_SUCCESS);
+}
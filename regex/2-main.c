@@ -0,0 +1,37 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "regex.h"
+
+/**
+ * main - Runs the memoized matcher with one scratch reused by every call,
+ * including a pattern that makes plain backtracking exponential
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    char const *tests[][2] = {
+        {"H", "H"}, {"HH", "H"}, {"HH", "H*"}, {"Holberton", ".*"},
+        {"Holberton", "Z*H.*olberton"}, {"Holberton", "Z*H.*o"},
+        {"Holberton", "holberton"}, {"Holberton", ".olberton"}
+    };
+    regex_scratch_t scratch = {NULL, 0, NULL, 0};
+    char str[201], pattern[61];
+    size_t i;
+
+    for (i = 0; i < sizeof(tests) / sizeof(*tests); i++)
+        printf("%s -> %s = %d\n", tests[i][0], tests[i][1],
+               regex_match_memo(tests[i][0], tests[i][1], &scratch));
+    memset(str, 'a', 200);
+    str[200] = '\0';
+    for (i = 0; i < 30; i++)
+        memcpy(pattern + 2 * i, "a*", 2);
+    pattern[60] = '\0';
+    pattern[59] = 'b';
+    printf("a x 200 -> (a*) x 29 ab = %d\n",
+           regex_match_memo(str, pattern, &scratch));
+    regex_scratch_free(&scratch);
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,47 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "regex.h"
+
+/**
+ * print_span - Prints a match and where it lies in the buffer
+ *
+ * @span: Location of the match
+ * @data: Buffer searched
+ *
+ * Return: Always 0, to keep searching
+ */
+int print_span(const regex_span_t *span, void *data)
+{
+    char const *buf = data;
+
+    printf("  [%lu, %lu) \"%.*s\"\n", (unsigned long)span->start,
+           (unsigned long)span->end, (int)(span->end - span->start),
+           buf + span->start);
+    return (0);
+}
+
+/**
+ * main - Searches a buffer for every match of a few patterns
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    char const *buf = "Holberton School, Holbie, Hello";
+    char const *patterns[] = {"Hol.*n", "H.l*", "oo*", "Z"};
+    regex_prog_t *prog;
+    size_t i;
+
+    for (i = 0; i < sizeof(patterns) / sizeof(*patterns); i++)
+    {
+        prog = regex_compile(patterns[i]);
+        if (!prog)
+            return (EXIT_FAILURE);
+        printf("%s:\n", patterns[i]);
+        regex_search_all(prog, buf, strlen(buf), print_span, (void *)buf);
+        regex_free(prog);
+    }
+    return (EXIT_SUCCESS);
+}
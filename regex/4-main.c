@@ -0,0 +1,74 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "regex.h"
+
+#define NSUBJECTS 1000
+
+/**
+ * run_budget - Matches every subject with a lazy DFA of a given budget
+ * and checks each result against regex_exec
+ *
+ * @prog: Compiled pattern
+ * @subjects: Strings to match
+ * @budget: Memory budget of the DFA, in bytes
+ *
+ * Return: 0 on success, -1 on failure or disagreement
+ */
+int run_budget(const regex_prog_t *prog, char subjects[][65],
+               size_t budget)
+{
+    regex_dfa_t *dfa = regex_dfa_new(prog, budget);
+    int i, matches = 0, m;
+
+    if (!dfa)
+        return (-1);
+    for (i = 0; i < NSUBJECTS; i++)
+    {
+        m = regex_dfa_match(dfa, subjects[i]);
+        if (m != regex_exec(prog, subjects[i]))
+        {
+            regex_dfa_free(dfa);
+            return (-1);
+        }
+        matches += m;
+    }
+    printf("budget %7lu: room for %4d states, %3d cached, %d matches,"
+           " %lu flushes\n", (unsigned long)budget, dfa->max_states,
+           dfa->nstates, matches, dfa->flushes);
+    regex_dfa_free(dfa);
+    return (0);
+}
+
+/**
+ * main - Matches the same subjects with a default and a tiny DFA cache
+ *
+ * The pattern has an 'a' 7 characters from the end: the DFA needs a
+ * state for every combination of a's among the last 8 characters, many
+ * more than a tiny budget holds.
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    static char subjects[NSUBJECTS][65];
+    regex_prog_t *prog = regex_compile(".*a.......");
+    unsigned long seed = 1;
+    int i, k, ret = 0;
+
+    if (!prog)
+        return (EXIT_FAILURE);
+    for (i = 0; i < NSUBJECTS; i++)
+    {
+        for (k = 0; k < 64; k++)
+        {
+            seed = seed * 1103515245 + 12345;
+            subjects[i][k] = (seed >> 16) % 2 ? 'a' : 'b';
+        }
+        subjects[i][64] = '\0';
+    }
+    if (run_budget(prog, subjects, 0) || run_budget(prog, subjects, 8192))
+        ret = 1;
+    regex_free(prog);
+    return (ret ? EXIT_FAILURE : EXIT_SUCCESS);
+}
@@ -0,0 +1,59 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "regex.h"
+
+#define NBIG 10003
+
+/**
+ * print_bits - Prints the bits of a batch's bitmap, one per string
+ *
+ * @bits: Bitmap
+ * @n: Number of strings
+ */
+void print_bits(const unsigned char *bits, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        printf("%d", bits[i / 8] >> (i % 8) & 1);
+    printf(" (bytes:");
+    for (i = 0; i < (n + 7) / 8; i++)
+        printf(" %02x", bits[i]);
+    printf(")\n");
+}
+
+/**
+ * main - Matches a batch of 11 strings, then one of 10003 strings, large
+ * enough to be split into slices, against "H.*n"
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    char const *strs[] = {"Holberton", "Hn", "Julien", "Hello", "H",
+                          "Hn!", "Holbie School San Fran", "", "HHHn",
+                          "hn", "Hon"};
+    static char const *big[NBIG];
+    static unsigned char bits[(NBIG + 7) / 8];
+    regex_prog_t *prog = regex_compile("H.*n");
+    size_t i, count = 0;
+
+    if (!prog || regex_match_many(prog, strs, 11, bits) == -1)
+        return (EXIT_FAILURE);
+    print_bits(bits, 11);
+    for (i = 0; i < NBIG; i++)
+        big[i] = strs[i % 11];
+    if (regex_match_many(prog, big, NBIG, bits) == -1)
+        return (EXIT_FAILURE);
+    for (i = 0; i < NBIG; i++)
+    {
+        if ((bits[i / 8] >> (i % 8) & 1) != regex_exec(prog, big[i]))
+            return (EXIT_FAILURE);
+        count += bits[i / 8] >> (i % 8) & 1;
+    }
+    printf("%lu of %d strings match, same as regex_exec\n",
+           (unsigned long)count, NBIG);
+    regex_free(prog);
+    return (EXIT_SUCCESS);
+}
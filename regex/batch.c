@@ -0,0 +1,116 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "regex.h"
+
+
+/**
+ * struct batch_s - Slice of a batch matched by one thread
+ *
+ * @prog: Compiled pattern
+ * @strs: Strings of the batch
+ * @lo: Index of the first string of the slice, a multiple of 8
+ * @hi: Index past the last string of the slice
+ * @out: Result bitmap of the whole batch
+ * @tid: Thread matching the slice
+ * @started: 1 if @tid was started, 0 if the slice was matched inline
+ */
+struct batch_s
+{
+	const regex_prog_t *prog;
+	char const **strs;
+	size_t lo;
+	size_t hi;
+	unsigned char *out;
+	pthread_t tid;
+	int started;
+};
+
+
+/**
+ * batch_run - Thread routine matching one slice of a batch
+ *
+ * Each slice gets its own lazy DFA, falling back to the NFA if the DFA
+ * cannot be allocated. Slices start on a byte boundary of the bitmap, so
+ * no two threads write the same byte.
+ *
+ * @arg: Slice, as a struct batch_s
+ *
+ * Return: Always NULL
+ */
+static void *batch_run(void *arg)
+{
+	struct batch_s *b = arg;
+	regex_dfa_t *dfa = regex_dfa_new(b->prog, 0);
+	unsigned char bit;
+	size_t i;
+	int match;
+
+	for (i = b->lo; i < b->hi; i++)
+	{
+		if (dfa)
+			match = regex_dfa_match(dfa, b->strs[i]);
+		else
+			match = regex_exec(b->prog, b->strs[i]);
+		bit = (unsigned char)(1U << (i % 8));
+		if (match)
+			b->out[i / 8] |= bit;
+		else
+			b->out[i / 8] &= (unsigned char)~bit;
+	}
+	regex_dfa_free(dfa);
+	return (NULL);
+}
+
+
+/**
+ * regex_match_many - Matches many strings against one compiled pattern
+ *
+ * The batch is split across the online CPUs, in slices of at least
+ * REGEX_BATCH_MIN strings.
+ *
+ * @prog: Compiled pattern
+ * @strs: Strings to match
+ * @n: Number of strings
+ * @out_bits: Bitmap of at least (n + 7) / 8 bytes; bit i % 8 of byte i / 8
+ * is set if strs[i] matches and cleared otherwise, other bits are kept
+ *
+ * Return: 0 on success, -1 on failure
+ */
+int regex_match_many(const regex_prog_t *prog, char const **strs, size_t n,
+		     unsigned char *out_bits)
+{
+	struct batch_s *slices;
+	size_t nslices, step, i;
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+	if (!prog || (n && (!strs || !out_bits)))
+		return (-1);
+	nslices = n / REGEX_BATCH_MIN;
+	if (cpus > 0 && nslices > (size_t)cpus)
+		nslices = cpus;
+	nslices = nslices ? nslices : 1;
+	step = ((n + nslices - 1) / nslices + 7) & ~(size_t)7;
+	nslices = step ? (n + step - 1) / step : 1;
+	slices = calloc(nslices, sizeof(*slices));
+	if (!slices)
+		return (-1);
+	for (i = 0; i < nslices; i++)
+	{
+		slices[i].prog = prog;
+		slices[i].strs = strs;
+		slices[i].out = out_bits;
+		slices[i].lo = i * step;
+		slices[i].hi = i + 1 < nslices ? (i + 1) * step : n;
+		slices[i].started = nslices > 1 &&
+			!pthread_create(&slices[i].tid, NULL, batch_run,
+					slices + i);
+		if (!slices[i].started)
+			batch_run(slices + i);
+	}
+	for (i = 0; i < nslices; i++)
+		if (slices[i].started)
+			pthread_join(slices[i].tid, NULL);
+	free(slices);
+	return (0);
+}
@@ -0,0 +1,122 @@
+#include <stdlib.h>
+#include <string.h>
+#include "regex.h"
+
+
+/**
+ * count_states - Counts the states a pattern compiles to
+ *
+ * @pattern: Regular expression
+ *
+ * Return: Number of states, the accepting one included
+ */
+static size_t count_states(char const *pattern)
+{
+	size_t n = 1;
+
+	while (*pattern)
+	{
+		pattern += pattern[1] == '*' ? 2 : 1;
+		n++;
+	}
+	return (n);
+}
+
+
+/**
+ * emit_states - Appends the states of one pattern to a program
+ *
+ * Each character of the pattern becomes one state; a '*' marks the
+ * preceding state as repeatable. A '*' that follows nothing is a literal,
+ * exactly as in the backtracking matcher.
+ *
+ * @prog: Program being compiled
+ * @pattern: Regular expression, made of characters, '.' and '*'
+ * @i: Index of the first state of the pattern
+ *
+ * Return: Index past the REGEX_END state of the pattern
+ */
+static size_t emit_states(regex_prog_t *prog, char const *pattern, size_t i)
+{
+	prog->start[i / REGEX_WORD_BITS] |= 1UL << (i % REGEX_WORD_BITS);
+	for (; *pattern; i++)
+	{
+		prog->states[i].type = *pattern == '.' ? REGEX_ANY : REGEX_CHAR;
+		prog->states[i].c = (unsigned char)*pattern;
+		prog->states[i].star = pattern[1] == '*';
+		pattern += prog->states[i].star ? 2 : 1;
+	}
+	prog->states[i].type = REGEX_END;
+	prog->accept[i / REGEX_WORD_BITS] |= 1UL << (i % REGEX_WORD_BITS);
+	return (i + 1);
+}
+
+
+/**
+ * regex_compile_many - Compiles several patterns into a single NFA
+ *
+ * The patterns are laid out one after the other, each one ending with its
+ * own REGEX_END state, and all of them start active. The k-th REGEX_END
+ * state accepts for patterns[k].
+ *
+ * @patterns: Regular expressions
+ * @n: Number of patterns, at least 1
+ *
+ * Return: The compiled program, or NULL on failure
+ */
+regex_prog_t *regex_compile_many(char const **patterns, size_t n)
+{
+	regex_prog_t *prog;
+	size_t nstates = 0, words, size, i;
+
+	if (!patterns || n == 0)
+		return (NULL);
+	for (i = 0; i < n; i++)
+	{
+		if (!patterns[i])
+			return (NULL);
+		nstates += count_states(patterns[i]);
+	}
+	words = (nstates + REGEX_WORD_BITS - 1) / REGEX_WORD_BITS;
+	size = sizeof(regex_lit_t) + sizeof(regex_state_t) + 1;
+	prog = calloc(1, sizeof(*prog) + 2 * words * sizeof(unsigned long) +
+		      nstates * size);
+	if (!prog)
+		return (NULL);
+	prog->start = (unsigned long *)(prog + 1);
+	prog->accept = prog->start + words;
+	prog->lits = (regex_lit_t *)(prog->accept + words);
+	prog->states = (regex_state_t *)(prog->lits + nstates);
+	prog->nstates = nstates;
+	prog->words = words;
+	for (nstates = 0, i = 0; i < n; i++)
+		nstates = emit_states(prog, patterns[i], nstates);
+	regex_closure(prog, prog->start);
+	if (n == 1)
+		regex_literals(prog, (char *)(prog->states + prog->nstates));
+	return (prog);
+}
+
+
+/**
+ * regex_compile - Compiles a pattern into an NFA
+ *
+ * @pattern: Regular expression, made of characters, '.' and '*'
+ *
+ * Return: The compiled pattern, or NULL on failure
+ */
+regex_prog_t *regex_compile(char const *pattern)
+{
+	return (regex_compile_many(&pattern, 1));
+}
+
+
+/**
+ * regex_free - Frees a compiled pattern
+ *
+ * @prog: Compiled pattern, may be NULL
+ */
+void regex_free(regex_prog_t *prog)
+{
+	free(prog);
+}
@@ -0,0 +1,131 @@
+#include <stdlib.h>
+#include <string.h>
+#include "regex.h"
+
+
+/**
+ * regex_dfa_new - Creates an empty lazy DFA for a compiled pattern
+ *
+ * @prog: Compiled pattern, must outlive the DFA
+ * @budget: Memory allowed for cached states in bytes, 0 for the default
+ *
+ * Return: The DFA, or NULL on failure
+ */
+regex_dfa_t *regex_dfa_new(const regex_prog_t *prog, size_t budget)
+{
+	regex_dfa_t *dfa;
+	size_t per_state, max;
+
+	if (!prog)
+		return (NULL);
+	per_state = prog->words * sizeof(unsigned long) + 256 * sizeof(int) +
+		1 + 2 * sizeof(int);
+	max = (budget ? budget : REGEX_DFA_BUDGET) / per_state;
+	max = max < 2 ? 2 : max > INT_MAX / 2 ? INT_MAX / 2 : max;
+	dfa = calloc(1, sizeof(*dfa));
+	if (!dfa)
+		return (NULL);
+	dfa->prog = prog;
+	dfa->max_states = (int)max;
+	for (dfa->bits = 1; (1UL << dfa->bits) < 2 * max; dfa->bits++)
+		;
+	dfa->sets = malloc(max * prog->words * sizeof(unsigned long));
+	dfa->next = malloc(max * 256 * sizeof(int));
+	dfa->accept = malloc(max);
+	dfa->slots = malloc(sizeof(int) << dfa->bits);
+	dfa->tmp = malloc(prog->words * sizeof(unsigned long));
+	if (!dfa->sets || !dfa->next || !dfa->accept || !dfa->slots ||
+	    !dfa->tmp)
+	{
+		regex_dfa_free(dfa);
+		return (NULL);
+	}
+	regex_dfa_flush(dfa);
+	dfa->flushes = 0;
+	return (dfa);
+}
+
+
+/**
+ * regex_dfa_free - Frees a lazy DFA
+ *
+ * @dfa: DFA to free, may be NULL
+ */
+void regex_dfa_free(regex_dfa_t *dfa)
+{
+	if (!dfa)
+		return;
+	free(dfa->sets);
+	free(dfa->next);
+	free(dfa->accept);
+	free(dfa->slots);
+	free(dfa->tmp);
+	free(dfa);
+}
+
+
+/**
+ * regex_dfa_flush - Drops every cached state but the start state
+ *
+ * The start state is always rebuilt first, so it is always state 0.
+ *
+ * @dfa: DFA
+ */
+void regex_dfa_flush(regex_dfa_t *dfa)
+{
+	memset(dfa->slots, -1, sizeof(int) << dfa->bits);
+	dfa->nstates = 0;
+	dfa->flushes++;
+	regex_dfa_add(dfa, dfa->prog->start);
+}
+
+
+/**
+ * regex_dfa_run - Runs a DFA over a whole string
+ *
+ * A cached transition costs a single table lookup per character; missing
+ * ones are computed from the NFA on first use.
+ *
+ * @dfa: DFA
+ * @str: String to scan
+ *
+ * Return: The DFA state reached at the end of @str, valid until the next
+ * call on @dfa, or REGEX_DFA_DEAD if no NFA state survived
+ */
+int regex_dfa_run(regex_dfa_t *dfa, char const *str)
+{
+	const unsigned char *s = (const unsigned char *)str;
+	int state = 0, to;
+
+	for (; *s; s++)
+	{
+		to = dfa->next[state * 256 + *s];
+		if (to == REGEX_DFA_UNKNOWN)
+			to = regex_dfa_next(dfa, state, *s);
+		if (to == REGEX_DFA_DEAD)
+			return (REGEX_DFA_DEAD);
+		state = to;
+	}
+	return (state);
+}
+
+
+/**
+ * regex_dfa_match - Checks whether the pattern of a DFA matches a string
+ *
+ * @dfa: DFA
+ * @str: String to scan
+ *
+ * Return: 1 on success or 0 on failure
+ */
+int regex_dfa_match(regex_dfa_t *dfa, char const *str)
+{
+	int state;
+
+	if (!dfa || !str)
+		return (0);
+	if (dfa->prog->nlits && !regex_prefilter(dfa->prog, str, strlen(str)))
+		return (0);
+	state = regex_dfa_run(dfa, str);
+	return (state != REGEX_DFA_DEAD && dfa->accept[state]);
+}
@@ -0,0 +1,93 @@
+#include <string.h>
+#include "regex.h"
+
+
+/**
+ * set_slot - Finds the table slot of a state set
+ *
+ * @dfa: DFA
+ * @set: NFA state set
+ *
+ * Return: The slot holding the DFA state of @set, or the free slot where
+ * it belongs
+ */
+static size_t set_slot(const regex_dfa_t *dfa, const unsigned long *set)
+{
+	size_t words = dfa->prog->words, mask = (1UL << dfa->bits) - 1;
+	unsigned long h = 14695981039346656037UL;
+	size_t w, i;
+	int id;
+
+	for (w = 0; w < words; w++)
+		h = (h ^ set[w]) * 1099511628211UL;
+	i = (h ^ (h >> 29)) & mask;
+	while ((id = dfa->slots[i]) != -1)
+	{
+		if (memcmp(dfa->sets + id * words, set,
+			   words * sizeof(*set)) == 0)
+			break;
+		i = (i + 1) & mask;
+	}
+	return (i);
+}
+
+
+/**
+ * regex_dfa_add - Finds or creates the DFA state of a set of NFA states
+ *
+ * When the cache is full it is flushed first, which invalidates every
+ * state index obtained before the call.
+ *
+ * @dfa: DFA
+ * @set: NFA state set, not stored in the DFA itself
+ *
+ * Return: The index of the DFA state
+ */
+int regex_dfa_add(regex_dfa_t *dfa, const unsigned long *set)
+{
+	size_t words = dfa->prog->words, slot = set_slot(dfa, set);
+	int id = dfa->slots[slot];
+
+	if (id != -1)
+		return (id);
+	if (dfa->nstates == dfa->max_states)
+	{
+		regex_dfa_flush(dfa);
+		slot = set_slot(dfa, set);
+		if (dfa->slots[slot] != -1)
+			return (dfa->slots[slot]);
+	}
+	id = dfa->nstates++;
+	memcpy(dfa->sets + id * words, set, words * sizeof(*set));
+	memset(dfa->next + id * 256, REGEX_DFA_UNKNOWN, 256 * sizeof(int));
+	dfa->accept[id] = regex_accepts(dfa->prog, set);
+	dfa->slots[slot] = id;
+	return (id);
+}
+
+
+/**
+ * regex_dfa_next - Computes and caches a missing transition
+ *
+ * @dfa: DFA
+ * @from: DFA state the transition leaves
+ * @c: Character of the subject
+ *
+ * Return: The DFA state reached, or REGEX_DFA_DEAD if no NFA state survives
+ */
+int regex_dfa_next(regex_dfa_t *dfa, int from, unsigned char c)
+{
+	unsigned long flushes = dfa->flushes;
+	int to;
+
+	if (!regex_step(dfa->prog, dfa->sets + from * dfa->prog->words,
+			dfa->tmp, c))
+	{
+		dfa->next[from * 256 + c] = REGEX_DFA_DEAD;
+		return (REGEX_DFA_DEAD);
+	}
+	to = regex_dfa_add(dfa, dfa->tmp);
+	if (dfa->flushes == flushes)
+		dfa->next[from * 256 + c] = to;
+	return (to);
+}
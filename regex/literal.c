@@ -0,0 +1,140 @@
+#define _GNU_SOURCE
+#include <string.h>
+#include "regex.h"
+
+
+/**
+ * regex_literals - Extracts the literal runs of a single pattern
+ *
+ * @prog: Program of a single pattern, states already emitted
+ * @bytes: Storage for the characters of the runs, nstates bytes
+ */
+void regex_literals(regex_prog_t *prog, char *bytes)
+{
+	const regex_state_t *st;
+	regex_lit_t *lit = NULL;
+	size_t i;
+
+	for (i = 0; prog->states[i].type != REGEX_END; i++)
+	{
+		st = prog->states + i;
+		prog->min_len += !st->star;
+		if (st->star || st->type != REGEX_CHAR)
+		{
+			lit = NULL;
+			continue;
+		}
+		if (!lit)
+		{
+			lit = prog->lits + prog->nlits++;
+			lit->s = bytes;
+			lit->len = 0;
+			if (i == 0)
+				prog->anchor |= REGEX_LIT_PREFIX;
+		}
+		*bytes++ = (char)st->c;
+		lit->len++;
+	}
+	if (lit)
+		prog->anchor |= REGEX_LIT_SUFFIX;
+}
+
+
+/**
+ * find_lit - Finds the first occurrence of a literal run
+ *
+ * Relies on the C library's vectorized memchr and memmem.
+ *
+ * @buf: Buffer to scan
+ * @len: Length of @buf
+ * @lit: Literal run
+ *
+ * Return: A pointer to the occurrence, or NULL if there is none
+ */
+static char const *find_lit(char const *buf, size_t len,
+			    const regex_lit_t *lit)
+{
+	if (lit->len == 1)
+		return (memchr(buf, lit->s[0], len));
+	return (memmem(buf, len, lit->s, lit->len));
+}
+
+
+/**
+ * regex_prefilter - Rejects cheaply strings a pattern cannot match whole
+ *
+ * Checks the length, the anchored first and last runs in place, then
+ * looks for the other runs in order between them.
+ *
+ * @prog: Compiled pattern
+ * @str: String to check
+ * @len: Length of @str
+ *
+ * Return: 0 if @str cannot match, 1 if it may
+ */
+int regex_prefilter(const regex_prog_t *prog, char const *str, size_t len)
+{
+	const regex_lit_t *lit = prog->lits, *end = prog->lits + prog->nlits;
+	char const *found;
+
+	if (len < prog->min_len)
+		return (0);
+	if (prog->anchor & REGEX_LIT_PREFIX)
+	{
+		if (memcmp(str, lit->s, lit->len) != 0)
+			return (0);
+		str += lit->len;
+		len -= lit->len;
+		lit++;
+	}
+	if (lit < end && (prog->anchor & REGEX_LIT_SUFFIX))
+	{
+		end--;
+		if (len < end->len ||
+		    memcmp(str + len - end->len, end->s, end->len) != 0)
+			return (0);
+		len -= end->len;
+	}
+	for (; lit < end; lit++)
+	{
+		found = find_lit(str, len, lit);
+		if (!found)
+			return (0);
+		len -= found + lit->len - str;
+		str = found + lit->len;
+	}
+	return (1);
+}
+
+
+/**
+ * regex_prefilter_from - Skips the part of a buffer no match can start in
+ *
+ * Every run must appear, in order, after the start of a match; a pattern
+ * starting with a run can only match where that run occurs.
+ *
+ * @prog: Compiled pattern
+ * @buf: Buffer to scan
+ * @len: Length of @buf
+ * @from: Offset at which the search starts
+ *
+ * Return: The first offset a match may start at, or REGEX_NO_START if
+ * there is no match at or after @from
+ */
+size_t regex_prefilter_from(const regex_prog_t *prog, char const *buf,
+			    size_t len, size_t from)
+{
+	char const *pos = buf + from, *found;
+	size_t i;
+
+	for (i = 0; i < prog->nlits; i++)
+	{
+		found = find_lit(pos, buf + len - pos, prog->lits + i);
+		if (!found)
+			return (REGEX_NO_START);
+		if (i == 0 && (prog->anchor & REGEX_LIT_PREFIX))
+			from = found - buf;
+		pos = found + prog->lits[i].len;
+	}
+	return (from);
+}
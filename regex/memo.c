@@ -0,0 +1,154 @@
+#include <stdlib.h>
+#include <string.h>
+#include "regex.h"
+
+
+/**
+ * struct memo_run_s - One call of the memoized matcher
+ *
+ * @str: String to scan
+ * @pattern: Regular expression
+ * @width: Number of pattern positions, strlen(pattern) + 1
+ * @top: Number of positions on the stack
+ * @scratch: Memory of the call
+ */
+struct memo_run_s
+{
+	char const *str;
+	char const *pattern;
+	size_t width;
+	size_t top;
+	regex_scratch_t *scratch;
+};
+
+
+/**
+ * scratch_reserve - Sizes the memo of a scratch buffer for a call
+ *
+ * @scratch: Scratch buffer
+ * @positions: Number of (string, pattern) positions of the call
+ *
+ * Return: 0 on success, -1 on failure
+ */
+static int scratch_reserve(regex_scratch_t *scratch, size_t positions)
+{
+	size_t size = positions / 8 + 1;
+	unsigned char *memo;
+
+	if (size > scratch->memo_size)
+	{
+		memo = realloc(scratch->memo, size);
+		if (!memo)
+			return (-1);
+		scratch->memo = memo;
+		scratch->memo_size = size;
+	}
+	memset(scratch->memo, 0, size);
+	return (0);
+}
+
+
+/**
+ * push_position - Schedules a position unless it was already explored
+ *
+ * A position is marked when pushed, so each one is evaluated at most once
+ * and the stack never holds more entries than there are positions.
+ *
+ * @run: Call of the matcher
+ * @i: Index in the string
+ * @j: Index in the pattern
+ *
+ * Return: 0 on success, -1 on failure
+ */
+static int push_position(struct memo_run_s *run, size_t i, size_t j)
+{
+	regex_scratch_t *scratch = run->scratch;
+	size_t pos = i * run->width + j, size;
+	size_t *stack;
+
+	if ((scratch->memo[pos / 8] >> (pos % 8)) & 1)
+		return (0);
+	scratch->memo[pos / 8] |= (unsigned char)(1U << (pos % 8));
+	if (run->top == scratch->stack_size)
+	{
+		size = scratch->stack_size ? scratch->stack_size * 2 : 64;
+		stack = realloc(scratch->stack, size * sizeof(*stack));
+		if (!stack)
+			return (-1);
+		scratch->stack = stack;
+		scratch->stack_size = size;
+	}
+	scratch->stack[run->top++] = pos;
+	return (0);
+}
+
+
+/**
+ * regex_match_memo - Checks whether a given pattern matches a given string,
+ * backtracking with a memo
+ *
+ * Follows the same two-way choice on '*' as the recursive matcher, but
+ * from an explicit stack, and never explores a (string, pattern) position
+ * twice: O(len(str) x len(pattern)) time and bits of memory.
+ *
+ * @str: string to scan
+ * @pattern: regular expression
+ * @scratch: Memory reused across calls, owned by the caller
+ *
+ * Return: 1 on success or 0 on failure
+ */
+int regex_match_memo(char const *str, char const *pattern,
+		     regex_scratch_t *scratch)
+{
+	struct memo_run_s run = {NULL, NULL, 0, 0, NULL};
+	size_t i, j, n;
+	int err, hit;
+
+	if (!str || !pattern || !scratch)
+		return (0);
+	run.str = str;
+	run.pattern = pattern;
+	run.scratch = scratch;
+	run.width = strlen(pattern) + 1;
+	n = strlen(str) + 1;
+	if (n > ((size_t)-1 - 8) / run.width ||
+	    scratch_reserve(scratch, n * run.width) == -1)
+		return (0);
+	err = push_position(&run, 0, 0);
+	while (!err && run.top)
+	{
+		i = scratch->stack[--run.top] / run.width;
+		j = scratch->stack[run.top] % run.width;
+		if (pattern[j] == '\0' && str[i] == '\0')
+			return (1);
+		if (pattern[j] == '\0')
+			continue;
+		hit = str[i] != '\0' &&
+			(str[i] == pattern[j] || pattern[j] == '.');
+		if (pattern[j + 1] == '*')
+		{
+			if (hit)
+				err = push_position(&run, i + 1, j);
+			if (!err)
+				err = push_position(&run, i, j + 2);
+		}
+		else if (hit)
+			err = push_position(&run, i + 1, j + 1);
+	}
+	return (0);
+}
+
+
+/**
+ * regex_scratch_free - Releases the memory of a scratch buffer
+ *
+ * @scratch: Scratch buffer, left zeroed and ready for reuse
+ */
+void regex_scratch_free(regex_scratch_t *scratch)
+{
+	if (!scratch)
+		return;
+	free(scratch->memo);
+	free(scratch->stack);
+	memset(scratch, 0, sizeof(*scratch));
+}
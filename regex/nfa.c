@@ -0,0 +1,125 @@
+#include <stdlib.h>
+#include <string.h>
+#include "regex.h"
+
+
+/**
+ * regex_closure - Adds to a set every state reachable without input
+ *
+ * A starred state may match zero times, so it also activates the next
+ * state. Stars only lead forward, so one ascending pass is enough.
+ *
+ * @prog: Compiled pattern
+ * @set: State set to close, in place
+ */
+void regex_closure(const regex_prog_t *prog, unsigned long *set)
+{
+	size_t i;
+
+	for (i = 0; i + 1 < prog->nstates; i++)
+		if (prog->states[i].star &&
+		    (set[i / REGEX_WORD_BITS] >> (i % REGEX_WORD_BITS)) & 1)
+			set[(i + 1) / REGEX_WORD_BITS] |=
+				1UL << ((i + 1) % REGEX_WORD_BITS);
+}
+
+
+/**
+ * regex_step - Computes the states active after one more character
+ *
+ * @prog: Compiled pattern
+ * @cur: States active before @c
+ * @next: Receives the closed set of states active after @c
+ * @c: Character of the subject
+ *
+ * Return: 1 if @next is not empty, 0 if no state survived
+ */
+int regex_step(const regex_prog_t *prog, const unsigned long *cur,
+	       unsigned long *next, unsigned char c)
+{
+	const regex_state_t *st;
+	unsigned long bits, alive = 0;
+	size_t w, i, to;
+
+	memset(next, 0, prog->words * sizeof(*next));
+	for (w = 0; w < prog->words; w++)
+	{
+		for (bits = cur[w]; bits; bits &= bits - 1)
+		{
+			i = w * REGEX_WORD_BITS + __builtin_ctzl(bits);
+			st = prog->states + i;
+			if (st->type == REGEX_END ||
+			    (st->type == REGEX_CHAR && st->c != c))
+				continue;
+			to = st->star ? i : i + 1;
+			next[to / REGEX_WORD_BITS] |=
+				1UL << (to % REGEX_WORD_BITS);
+			alive = 1;
+		}
+	}
+	if (alive)
+		regex_closure(prog, next);
+	return (alive != 0);
+}
+
+
+/**
+ * regex_accepts - Tells whether a state set contains an accepting state
+ *
+ * @prog: Compiled pattern
+ * @set: State set
+ *
+ * Return: 1 if @set accepts, 0 otherwise
+ */
+int regex_accepts(const regex_prog_t *prog, const unsigned long *set)
+{
+	size_t w;
+
+	for (w = 0; w < prog->words; w++)
+		if (set[w] & prog->accept[w])
+			return (1);
+	return (0);
+}
+
+
+/**
+ * regex_exec - Checks whether a compiled pattern matches a whole string
+ *
+ * Strings missing a literal run of the pattern are rejected up front;
+ * the others go through the NFA, without recursion, in
+ * O(len(str) x len(pattern)) time whatever the pattern.
+ *
+ * @prog: Compiled pattern
+ * @str: String to scan
+ *
+ * Return: 1 on success or 0 on failure
+ */
+int regex_exec(const regex_prog_t *prog, char const *str)
+{
+	unsigned long local[2 * REGEX_STACK_WORDS], *sets = local;
+	unsigned long *cur, *next, *tmp;
+	int match;
+
+	if (!prog || !str)
+		return (0);
+	if (prog->nlits && !regex_prefilter(prog, str, strlen(str)))
+		return (0);
+	if (prog->words > REGEX_STACK_WORDS)
+		sets = malloc(2 * prog->words * sizeof(*sets));
+	if (!sets)
+		return (0);
+	cur = sets;
+	next = sets + prog->words;
+	memcpy(cur, prog->start, prog->words * sizeof(*cur));
+	for (match = 1; match && *str; str++)
+	{
+		match = regex_step(prog, cur, next, (unsigned char)*str);
+		tmp = cur;
+		cur = next;
+		next = tmp;
+	}
+	match = match && regex_accepts(prog, cur);
+	if (sets != local)
+		free(sets);
+	return (match);
+}
@@ -1,6 +1,224 @@
 #ifndef REGEX_H
 #define REGEX_H
 
+#include <limits.h>
+#include <stddef.h>
+
+#define REGEX_CHAR 0
+#define REGEX_ANY 1
+#define REGEX_END 2
+
+#define REGEX_WORD_BITS (sizeof(unsigned long) * CHAR_BIT)
+#define REGEX_STACK_WORDS 4
+
+/**
+ * struct regex_state_s - NFA state, matching one character of the subject
+ *
+ * @type: REGEX_CHAR, REGEX_ANY for '.', or REGEX_END for the accepting state
+ * @c: Character matched by a REGEX_CHAR state
+ * @star: 1 if the state was followed by '*' and may match any number of
+ * times, 0 if it must match exactly once
+ */
+struct regex_state_s
+{
+	unsigned char type;
+	unsigned char c;
+	unsigned char star;
+};
+
+typedef struct regex_state_s regex_state_t;
+
+/**
+ * struct regex_lit_s - Run of characters every match must contain
+ *
+ * @s: Characters of the run, not NUL-terminated
+ * @len: Number of characters
+ */
+struct regex_lit_s
+{
+	char const *s;
+	size_t len;
+};
+
+typedef struct regex_lit_s regex_lit_t;
+
+#define REGEX_LIT_PREFIX 1
+#define REGEX_LIT_SUFFIX 2
+
+/**
+ * struct regex_prog_s - Compiled pattern
+ *
+ * State sets are bitsets of @words unsigned longs, bit i standing for
+ * "about to match state i". A compiled pattern is never written to once
+ * built, so it can be shared by any number of threads.
+ *
+ * @states: States of the NFA, in pattern order
+ * @nstates: Number of states
+ * @words: Number of unsigned longs in a state set
+ * @start: Set of states active before the first character
+ * @accept: Set of the REGEX_END states, one per compiled pattern
+ * @lits: Literal runs of a single pattern, in pattern order: consecutive
+ * characters that are neither '.' nor starred
+ * @nlits: Number of literal runs, 0 for a set of patterns
+ * @anchor: REGEX_LIT_PREFIX if the first run starts the pattern,
+ * REGEX_LIT_SUFFIX if the last run ends it
+ * @min_len: Length of the shortest string the pattern can match
+ */
+struct regex_prog_s
+{
+	regex_state_t *states;
+	size_t nstates;
+	size_t words;
+	unsigned long *start;
+	unsigned long *accept;
+	regex_lit_t *lits;
+	size_t nlits;
+	int anchor;
+	size_t min_len;
+};
+
+typedef struct regex_prog_s regex_prog_t;
+
+/**
+ * struct regex_dfa_s - DFA built lazily over a compiled pattern
+ *
+ * Each DFA state stands for one set of NFA states and is created the first
+ * time the subject reaches it. All the memory is allocated up front; once
+ * @max_states states exist the cache is flushed and rebuilt from scratch.
+ * A DFA caches as it runs, so it must not be shared between threads.
+ *
+ * @prog: Compiled pattern
+ * @sets: NFA state set of each DFA state, prog->words unsigned longs each
+ * @next: 256 transitions per DFA state, REGEX_DFA_UNKNOWN until computed
+ * @accept: 1 for each accepting DFA state, 0 otherwise
+ * @slots: Open-addressing table of DFA states by set, -1 marks a free slot
+ * @bits: Log2 of the number of slots
+ * @tmp: Scratch set used while computing a transition
+ * @nstates: Number of DFA states currently cached
+ * @max_states: Number of DFA states the memory budget allows
+ * @flushes: Number of times the cache has been flushed
+ */
+struct regex_dfa_s
+{
+	const regex_prog_t *prog;
+	unsigned long *sets;
+	int *next;
+	unsigned char *accept;
+	int *slots;
+	int bits;
+	unsigned long *tmp;
+	int nstates;
+	int max_states;
+	unsigned long flushes;
+};
+
+typedef struct regex_dfa_s regex_dfa_t;
+
+#define REGEX_DFA_UNKNOWN -1
+#define REGEX_DFA_DEAD -2
+#define REGEX_DFA_BUDGET (1 << 20)
+#define REGEX_BATCH_MIN 1024
+
+/**
+ * struct regex_set_s - Patterns merged into a single automaton
+ *
+ * @prog: Program holding every pattern, see regex_compile_many
+ * @ends: Index of the REGEX_END state of each pattern
+ * @n: Number of patterns
+ * @dfa: Lazy DFA over @prog, shared by every pattern
+ */
+struct regex_set_s
+{
+	regex_prog_t *prog;
+	size_t *ends;
+	size_t n;
+	regex_dfa_t *dfa;
+};
+
+typedef struct regex_set_s regex_set_t;
+
+/**
+ * struct regex_scratch_s - Caller-owned memory of the memoized matcher
+ *
+ * Zero-initialize it before the first call; it grows to the largest
+ * inputs seen and is reused by later calls until regex_scratch_free.
+ *
+ * @memo: Bitset of the (string, pattern) positions already explored
+ * @memo_size: Size of @memo in bytes
+ * @stack: Positions waiting to be explored, as string x pattern indices
+ * @stack_size: Number of positions @stack can hold
+ */
+struct regex_scratch_s
+{
+	unsigned char *memo;
+	size_t memo_size;
+	size_t *stack;
+	size_t stack_size;
+};
+
+typedef struct regex_scratch_s regex_scratch_t;
+
+/**
+ * struct regex_span_s - Location of a match in a buffer
+ *
+ * @start: Offset of the first byte of the match
+ * @end: Offset past the last byte of the match
+ */
+struct regex_span_s
+{
+	size_t start;
+	size_t end;
+};
+
+typedef struct regex_span_s regex_span_t;
+
+/**
+ * regex_span_cb_t - Receives each match found by regex_search_all
+ * Return non-zero to stop the search, that value is then returned by it
+ */
+typedef int (*regex_span_cb_t)(const regex_span_t *span, void *data);
+
+#define REGEX_NO_START ((size_t)-1)
+#define REGEX_STACK_STATES 64
+
 int regex_match(char const *str, char const *pattern);
+int regex_match_memo(char const *str, char const *pattern,
+		     regex_scratch_t *scratch);
+void regex_scratch_free(regex_scratch_t *scratch);
+
+regex_prog_t *regex_compile(char const *pattern);
+regex_prog_t *regex_compile_many(char const **patterns, size_t n);
+void regex_free(regex_prog_t *prog);
+int regex_exec(const regex_prog_t *prog, char const *str);
+int regex_search(const regex_prog_t *prog, char const *buf, size_t len,
+		 size_t from, regex_span_t *span);
+int regex_search_all(const regex_prog_t *prog, char const *buf, size_t len,
+		     regex_span_cb_t cb, void *data);
+int regex_match_many(const regex_prog_t *prog, char const **strs, size_t n,
+		     unsigned char *out_bits);
+
+regex_dfa_t *regex_dfa_new(const regex_prog_t *prog, size_t budget);
+void regex_dfa_free(regex_dfa_t *dfa);
+void regex_dfa_flush(regex_dfa_t *dfa);
+int regex_dfa_run(regex_dfa_t *dfa, char const *str);
+int regex_dfa_match(regex_dfa_t *dfa, char const *str);
+int regex_dfa_add(regex_dfa_t *dfa, const unsigned long *set);
+int regex_dfa_next(regex_dfa_t *dfa, int from, unsigned char c);
+
+regex_set_t *regex_set_compile(char const **patterns, size_t n,
+			       size_t budget);
+void regex_set_free(regex_set_t *set);
+int regex_set_match(regex_set_t *set, char const *str,
+		    unsigned char *out_bits);
+
+void regex_literals(regex_prog_t *prog, char *bytes);
+int regex_prefilter(const regex_prog_t *prog, char const *str, size_t len);
+size_t regex_prefilter_from(const regex_prog_t *prog, char const *buf,
+			    size_t len, size_t from);
+
+void regex_closure(const regex_prog_t *prog, unsigned long *set);
+int regex_step(const regex_prog_t *prog, const unsigned long *cur,
+	       unsigned long *next, unsigned char c);
+int regex_accepts(const regex_prog_t *prog, const unsigned long *set);
 
 #endif /* REGEX_H */
@@ -0,0 +1,184 @@
+#include <stdlib.h>
+#include <string.h>
+#include "regex.h"
+
+
+/**
+ * start_threads - Starts a match attempt at the current offset
+ *
+ * Every state carries the start offset of the earliest attempt that
+ * reached it; attempts started later never override an earlier one.
+ *
+ * @prog: Compiled pattern
+ * @starts: Start offset of each active state, REGEX_NO_START if inactive
+ * @p: Current offset
+ */
+static void start_threads(const regex_prog_t *prog, size_t *starts, size_t p)
+{
+	unsigned long w;
+	size_t i;
+
+	for (i = 0; i < prog->nstates; i++)
+	{
+		w = prog->start[i / REGEX_WORD_BITS] >> (i % REGEX_WORD_BITS);
+		if (starts[i] == REGEX_NO_START && (w & 1))
+			starts[i] = p;
+	}
+}
+
+
+/**
+ * step_threads - Advances every active state over one byte
+ *
+ * @prog: Compiled pattern
+ * @cur: Start offsets of the states active before @c
+ * @next: Receives the start offsets of the states active after @c
+ * @c: Byte of the buffer
+ *
+ * Return: 1 if a state is still active, 0 otherwise
+ */
+static int step_threads(const regex_prog_t *prog, const size_t *cur,
+			size_t *next, unsigned char c)
+{
+	const regex_state_t *st;
+	size_t i, to;
+	int alive = 0;
+
+	for (i = 0; i < prog->nstates; i++)
+		next[i] = REGEX_NO_START;
+	for (i = 0; i < prog->nstates; i++)
+	{
+		st = prog->states + i;
+		if (cur[i] == REGEX_NO_START || st->type == REGEX_END ||
+		    (st->type == REGEX_CHAR && st->c != c))
+			continue;
+		to = st->star ? i : i + 1;
+		if (cur[i] < next[to])
+			next[to] = cur[i];
+		alive = 1;
+	}
+	for (i = 0; i + 1 < prog->nstates; i++)
+		if (prog->states[i].star && next[i] < next[i + 1])
+			next[i + 1] = next[i];
+	return (alive);
+}
+
+
+/**
+ * keep_best - Records the accepting states and drops hopeless attempts
+ *
+ * The best match starts first, then ends last. Once a match is known,
+ * attempts that started after it can only lose and are dropped.
+ *
+ * @prog: Compiled pattern
+ * @starts: Start offsets of the active states
+ * @p: Current offset, end of any match accepted here
+ * @best: Best match so far, start is REGEX_NO_START if none
+ *
+ * Return: 1 if a state is still active, 0 otherwise
+ */
+static int keep_best(const regex_prog_t *prog, size_t *starts, size_t p,
+		     regex_span_t *best)
+{
+	size_t i;
+	int alive = 0;
+
+	for (i = 0; i < prog->nstates; i++)
+		if (prog->states[i].type == REGEX_END &&
+		    starts[i] != REGEX_NO_START && starts[i] <= best->start)
+		{
+			best->start = starts[i];
+			best->end = p;
+		}
+	for (i = 0; i < prog->nstates; i++)
+	{
+		if (starts[i] != REGEX_NO_START && starts[i] > best->start)
+			starts[i] = REGEX_NO_START;
+		alive |= starts[i] != REGEX_NO_START;
+	}
+	return (alive);
+}
+
+
+/**
+ * regex_search - Finds the leftmost-longest match of a pattern in a buffer
+ *
+ * Skips to where the pattern's literal runs allow a match, then runs
+ * every match attempt at once in a single pass over the buffer:
+ * O(scanned bytes x len(pattern)). The buffer need not be NUL-terminated;
+ * '.' matches any byte.
+ *
+ * @prog: Compiled pattern
+ * @buf: Buffer to scan
+ * @len: Length of @buf
+ * @from: Offset at which the search starts
+ * @span: Receives the location of the match
+ *
+ * Return: 1 if a match was found, 0 otherwise
+ */
+int regex_search(const regex_prog_t *prog, char const *buf, size_t len,
+		 size_t from, regex_span_t *span)
+{
+	size_t local[2 * REGEX_STACK_STATES], *sets = local, *cur, *tmp, p;
+	regex_span_t best = {REGEX_NO_START, 0};
+	int alive = 1;
+
+	if (!prog || !buf || !span || from > len)
+		return (0);
+	from = regex_prefilter_from(prog, buf, len, from);
+	if (from == REGEX_NO_START)
+		return (0);
+	if (prog->nstates > REGEX_STACK_STATES)
+		sets = malloc(2 * prog->nstates * sizeof(*sets));
+	if (!sets)
+		return (0);
+	cur = sets;
+	memset(cur, 0xff, prog->nstates * sizeof(*cur));
+	for (p = from; alive || best.start == REGEX_NO_START; p++)
+	{
+		if (best.start == REGEX_NO_START)
+			start_threads(prog, cur, p);
+		alive = keep_best(prog, cur, p, &best);
+		if (p == len)
+			break;
+		tmp = cur == sets ? sets + prog->nstates : sets;
+		alive = step_threads(prog, cur, tmp, (unsigned char)buf[p]);
+		cur = tmp;
+	}
+	if (sets != local)
+		free(sets);
+	*span = best;
+	return (best.start != REGEX_NO_START);
+}
+
+
+/**
+ * regex_search_all - Reports every non-overlapping match in a buffer
+ *
+ * Matches are leftmost-longest, reported in order; each search resumes
+ * where the previous match ended, one byte later after an empty match.
+ *
+ * @prog: Compiled pattern
+ * @buf: Buffer to scan, need not be NUL-terminated
+ * @len: Length of @buf
+ * @cb: Function called with each match
+ * @data: Argument passed to @cb
+ *
+ * Return: 0 once the buffer is scanned, or the non-zero value of @cb
+ */
+int regex_search_all(const regex_prog_t *prog, char const *buf, size_t len,
+		     regex_span_cb_t cb, void *data)
+{
+	regex_span_t span;
+	size_t from = 0;
+	int ret;
+
+	while (from <= len && regex_search(prog, buf, len, from, &span))
+	{
+		ret = cb(&span, data);
+		if (ret)
+			return (ret);
+		from = span.end > span.start ? span.end : span.end + 1;
+	}
+	return (0);
+}
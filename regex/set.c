@@ -0,0 +1,94 @@
+#include <stdlib.h>
+#include <string.h>
+#include "regex.h"
+
+
+/**
+ * regex_set_compile - Merges several patterns into one automaton
+ *
+ * @patterns: Regular expressions
+ * @n: Number of patterns, at least 1
+ * @budget: Memory allowed for the DFA cache in bytes, 0 for the default
+ *
+ * Return: The pattern set, or NULL on failure
+ */
+regex_set_t *regex_set_compile(char const **patterns, size_t n,
+			       size_t budget)
+{
+	regex_set_t *set;
+	size_t i, k;
+
+	set = calloc(1, sizeof(*set));
+	if (!set)
+		return (NULL);
+	set->n = n;
+	set->prog = regex_compile_many(patterns, n);
+	set->ends = malloc(sizeof(*set->ends) * (n ? n : 1));
+	set->dfa = regex_dfa_new(set->prog, budget);
+	if (!set->prog || !set->ends || !set->dfa)
+	{
+		regex_set_free(set);
+		return (NULL);
+	}
+	for (i = 0, k = 0; i < set->prog->nstates; i++)
+		if (set->prog->states[i].type == REGEX_END)
+			set->ends[k++] = i;
+	return (set);
+}
+
+
+/**
+ * regex_set_free - Frees a pattern set
+ *
+ * @set: Pattern set, may be NULL
+ */
+void regex_set_free(regex_set_t *set)
+{
+	if (!set)
+		return;
+	regex_dfa_free(set->dfa);
+	regex_free(set->prog);
+	free(set->ends);
+	free(set);
+}
+
+
+/**
+ * regex_set_match - Finds which patterns of a set match a string
+ *
+ * The string is scanned once by the merged DFA, whatever the number of
+ * patterns; the patterns matched are read from the final state. The set
+ * caches DFA states, so it must not be shared between threads.
+ *
+ * @set: Pattern set
+ * @str: String to scan
+ * @out_bits: Bitmap of at least (n + 7) / 8 bytes; bit k % 8 of byte k / 8
+ * is set if pattern k matches and cleared otherwise
+ *
+ * Return: The number of patterns matched, or -1 on failure
+ */
+int regex_set_match(regex_set_t *set, char const *str,
+		    unsigned char *out_bits)
+{
+	const unsigned long *final;
+	size_t k, e;
+	int state, count = 0;
+
+	if (!set || !str || !out_bits)
+		return (-1);
+	memset(out_bits, 0, (set->n + 7) / 8);
+	state = regex_dfa_run(set->dfa, str);
+	if (state == REGEX_DFA_DEAD || !set->dfa->accept[state])
+		return (0);
+	final = set->dfa->sets + state * set->prog->words;
+	for (k = 0; k < set->n; k++)
+	{
+		e = set->ends[k];
+		if ((final[e / REGEX_WORD_BITS] >> (e % REGEX_WORD_BITS)) & 1)
+		{
+			out_bits[k / 8] |= (unsigned char)(1U << (k % 8));
+			count++;
+		}
+	}
+	return (count);
+}
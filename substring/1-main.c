@@ -0,0 +1,61 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "substring.h"
+
+/**
+ * print_index - Prints the stream offset of a match
+ *
+ * @idx: Offset of the match from the start of the stream
+ * @data: Unused
+ *
+ * Return: Always 0, to keep scanning
+ */
+int print_index(uint64_t idx, void *data)
+{
+    (void)data;
+    printf(" %" PRIu64, idx);
+    return (0);
+}
+
+/**
+ * main - Scans a string delivered in chunks of 1 to 5 bytes, then the
+ * same string stored in a file
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    char const *s = "barfoofoobarthefoobarman";
+    char const *words[] = {"bar", "foo", "the"};
+    substring_t *sub = substring_compile(words, 3);
+    substring_stream_t *st;
+    FILE *f = tmpfile();
+    size_t chunk, i, len = strlen(s);
+
+    if (!sub || !f)
+        return (EXIT_FAILURE);
+    for (chunk = 1; chunk <= 5; chunk++)
+    {
+        st = substring_stream_new(sub, print_index, NULL);
+        if (!st)
+            return (EXIT_FAILURE);
+        printf("chunks of %lu ->", (unsigned long)chunk);
+        for (i = 0; i < len; i += chunk)
+            substring_stream_feed(st, s + i, len - i < chunk ? len - i : chunk);
+        substring_stream_free(st);
+        printf("\n");
+    }
+    fputs(s, f);
+    fflush(f);
+    rewind(f);
+    printf("file ->");
+    if (substring_scan_fd(sub, fileno(f), print_index, NULL) == -1)
+        return (EXIT_FAILURE);
+    printf("\n");
+    fclose(f);
+    substring_free(sub);
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,43 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "substring.h"
+
+#define LEN (1 << 20)
+
+/**
+ * main - Scans a 1 MiB string on 1 to 4 threads and checks that every
+ * run finds the indices of the serial scan
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+    char const *words[] = {"ab", "ba", "ab"};
+    char const *unit = "abbaabxbaabab";
+    substring_t *sub = substring_compile(words, 3);
+    char *s = malloc(LEN + 1);
+    int *ref, *res, nref, n, t;
+    size_t i;
+
+    if (!sub || !s)
+        return (EXIT_FAILURE);
+    for (i = 0; i < LEN; i++)
+        s[i] = unit[i % strlen(unit)];
+    s[LEN] = '\0';
+    ref = substring_exec(sub, s, &nref);
+    printf("serial: %d matches, first at %d\n", nref, nref ? ref[0] : -1);
+    for (t = 1; t <= 4; t++)
+    {
+        res = substring_exec_parallel(sub, s, &n, t);
+        printf("%d thread(s): %d matches, %s\n", t, n,
+               n == nref && (!n || !memcmp(res, ref, sizeof(*res) * n)) ?
+               "same as serial" : "DIFFERENT");
+        free(res);
+    }
+    free(ref);
+    free(s);
+    substring_free(sub);
+    return (EXIT_SUCCESS);
+}
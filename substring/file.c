@@ -0,0 +1,125 @@
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "substring.h"
+
+
+/**
+ * scan_mapped - Scans a regular file mapped in memory
+ *
+ * @sub: Matcher
+ * @fd: Open file descriptor of the file
+ * @size: Size of the file
+ * @cb: Function called with the index of each match
+ * @data: Argument passed to @cb
+ *
+ * Return: 0 on success, -1 on failure, or the non-zero value of @cb
+ */
+static int scan_mapped(const substring_t *sub, int fd, size_t size,
+		       substring_stream_cb_t cb, void *data)
+{
+	substring_stream_t *st;
+	char *map;
+	int ret;
+
+	map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (map == MAP_FAILED)
+		return (-1);
+	madvise(map, size, MADV_SEQUENTIAL);
+	st = substring_stream_new(sub, cb, data);
+	ret = st ? substring_stream_feed(st, map, size) : -1;
+	substring_stream_free(st);
+	munmap(map, size);
+	return (ret);
+}
+
+
+/**
+ * scan_read - Scans a file descriptor chunk by chunk
+ *
+ * @sub: Matcher
+ * @fd: File descriptor to read until end of file
+ * @cb: Function called with the index of each match
+ * @data: Argument passed to @cb
+ *
+ * Return: 0 on success, -1 on failure, or the non-zero value of @cb
+ */
+static int scan_read(const substring_t *sub, int fd,
+		     substring_stream_cb_t cb, void *data)
+{
+	substring_stream_t *st;
+	char *buf;
+	ssize_t r;
+	int ret = -1;
+
+	st = substring_stream_new(sub, cb, data);
+	buf = malloc(SUBSTRING_CHUNK);
+	if (st && buf)
+	{
+		ret = 0;
+		while (!ret && (r = read(fd, buf, SUBSTRING_CHUNK)) != 0)
+		{
+			if (r == -1)
+				ret = -1;
+			else
+				ret = substring_stream_feed(st, buf, r);
+		}
+	}
+	free(buf);
+	substring_stream_free(st);
+	return (ret);
+}
+
+
+/**
+ * substring_scan_fd - Scans everything readable from a file descriptor
+ *
+ * Large regular files are mapped in memory, anything else (pipes,
+ * sockets, small files) is read in SUBSTRING_CHUNK byte chunks.
+ *
+ * @sub: Matcher
+ * @fd: File descriptor to scan
+ * @cb: Function called with the absolute index of each match, in order
+ * @data: Argument passed to @cb
+ *
+ * Return: 0 on success, -1 on failure, or the non-zero value of @cb
+ */
+int substring_scan_fd(const substring_t *sub, int fd,
+		      substring_stream_cb_t cb, void *data)
+{
+	struct stat sb;
+
+	if (!sub || !cb)
+		return (-1);
+	if (fstat(fd, &sb) == 0 && S_ISREG(sb.st_mode) &&
+	    sb.st_size >= SUBSTRING_MMAP_MIN &&
+	    (uint64_t)sb.st_size <= SIZE_MAX)
+		return (scan_mapped(sub, fd, sb.st_size, cb, data));
+	return (scan_read(sub, fd, cb, data));
+}
+
+
+/**
+ * substring_scan_file - Scans a whole file
+ *
+ * @sub: Matcher
+ * @path: Path of the file to scan
+ * @cb: Function called with the absolute index of each match, in order
+ * @data: Argument passed to @cb
+ *
+ * Return: 0 on success, -1 on failure, or the non-zero value of @cb
+ */
+int substring_scan_file(const substring_t *sub, char const *path,
+			substring_stream_cb_t cb, void *data)
+{
+	int fd, ret;
+
+	fd = open(path, O_RDONLY);
+	if (fd == -1)
+		return (-1);
+	ret = substring_scan_fd(sub, fd, cb, data);
+	close(fd);
+	return (ret);
+}
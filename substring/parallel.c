@@ -0,0 +1,157 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "substring.h"
+
+
+/**
+ * struct part_s - Range of start positions scanned by one thread
+ *
+ * @sub: Matcher
+ * @s: Start of the range in the scanned string
+ * @lo: Index of @s in the scanned string
+ * @len: Number of bytes to scan, the range plus span - 1 bytes of overlap
+ * @res: Indices found in the range
+ * @ret: Status of the scan
+ * @tid: Thread scanning the range
+ * @started: 1 if @tid was started, 0 if the range was scanned inline
+ */
+struct part_s
+{
+	const substring_t *sub;
+	char const *s;
+	size_t lo;
+	size_t len;
+	substring_result_t res;
+	int ret;
+	pthread_t tid;
+	int started;
+};
+
+
+/**
+ * part_push - Appends a found index to a range's results
+ *
+ * @idx: Index of the match, relative to the range
+ * @data: Range, as a struct part_s
+ *
+ * Return: 0 on success, -1 on failure
+ */
+static int part_push(size_t idx, void *data)
+{
+	struct part_s *part = data;
+
+	return (substring_result_push(part->lo + idx, &part->res));
+}
+
+
+/**
+ * part_run - Thread routine scanning one range
+ *
+ * @arg: Range, as a struct part_s
+ *
+ * Return: Always NULL
+ */
+static void *part_run(void *arg)
+{
+	struct part_s *part = arg;
+
+	part->ret = substring_scan(part->sub, part->s, part->len,
+				   part_push, part);
+	return (NULL);
+}
+
+
+/**
+ * merge_parts - Concatenates the results of every range
+ *
+ * Ranges are ordered and each one is sorted, so concatenating them keeps
+ * the indices sorted; an index repeated across a boundary is kept once.
+ *
+ * @parts: Ranges, in order
+ * @nparts: Number of ranges
+ * @n: Address at which to store the number of elements in the returned array
+ *
+ * Return: An allocated array of indices, or NULL on failure or if empty
+ */
+static int *merge_parts(struct part_s *parts, size_t nparts, int *n)
+{
+	size_t total = 0, i, j;
+	int *res;
+
+	for (i = 0; i < nparts; i++)
+	{
+		if (parts[i].ret)
+			return (NULL);
+		total += parts[i].res.n;
+	}
+	res = total ? malloc(sizeof(*res) * total) : NULL;
+	if (!res)
+		return (NULL);
+	for (i = 0; i < nparts; i++)
+		for (j = 0; j < parts[i].res.n; j++)
+			if (*n == 0 || parts[i].res.arr[j] > res[*n - 1])
+				res[(*n)++] = parts[i].res.arr[j];
+	return (res);
+}
+
+
+/**
+ * substring_exec_parallel - Finds all the substrings matched by a compiled
+ * matcher, splitting the string across threads
+ *
+ * Each thread scans a range of start positions, reading span - 1 bytes past
+ * its end so that a match starting in the range is seen whole.
+ *
+ * @sub: Matcher built by substring_compile
+ * @s: String to scan
+ * @n: Address at which to store the number of elements in the returned array
+ * @nthreads: Number of threads, or 0 to use every online CPU
+ *
+ * Return: The same array substring_exec would return, or NULL on failure
+ */
+int *substring_exec_parallel(const substring_t *sub, char const *s, int *n,
+			     int nthreads)
+{
+	struct part_s *parts;
+	size_t len, span, starts, step, nparts, i;
+	int *res;
+
+	*n = 0;
+	if (!sub || !s)
+		return (NULL);
+	len = strlen(s);
+	span = sub->wlen * sub->nb_words;
+	starts = len >= span ? len - span + 1 : 0;
+	nparts = nthreads > 0 ? nthreads : sysconf(_SC_NPROCESSORS_ONLN);
+	if (nparts > starts / SUBSTRING_PART_MIN)
+		nparts = starts / SUBSTRING_PART_MIN;
+	if (nparts < 2)
+		return (substring_exec(sub, s, n));
+	step = (starts + nparts - 1) / nparts;
+	nparts = (starts + step - 1) / step;
+	parts = calloc(nparts, sizeof(*parts));
+	if (!parts)
+		return (NULL);
+	for (i = 0; i < nparts; i++)
+	{
+		parts[i].sub = sub;
+		parts[i].lo = i * step;
+		parts[i].s = s + parts[i].lo;
+		parts[i].len = (i + 1 < nparts ? step : starts - parts[i].lo) +
+			span - 1;
+		parts[i].started = !pthread_create(&parts[i].tid, NULL,
+						   part_run, parts + i);
+		if (!parts[i].started)
+			part_run(parts + i);
+	}
+	for (i = 0; i < nparts; i++)
+		if (parts[i].started)
+			pthread_join(parts[i].tid, NULL);
+	res = merge_parts(parts, nparts, n);
+	for (i = 0; i < nparts; i++)
+		free(parts[i].res.arr);
+	free(parts);
+	return (res);
+}
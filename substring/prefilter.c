@@ -0,0 +1,181 @@
+#include <string.h>
+#include "substring.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SUBSTRING_X86 1
+#endif
+
+
+/**
+ * filter_scalar - Flags the positions starting with a word prefix
+ *
+ * @sub: Compiled matcher
+ * @s: Start of the block of 64 positions
+ * @avail: Number of readable bytes from @s
+ * @from: First position of the block to test
+ *
+ * Return: A mask whose bit i is set if position i may start a word
+ */
+static uint64_t filter_scalar(const substring_t *sub, char const *s,
+			      size_t avail, size_t from)
+{
+	uint64_t mask = 0;
+	uint32_t w;
+	size_t i;
+	int q;
+
+	for (i = from; i < 64 && i + sub->pfx_len <= avail; i++)
+	{
+		w = 0;
+		memcpy(&w, s + i, sub->pfx_len);
+		for (q = 0; q < sub->nb_pfx; q++)
+			if (w == sub->pfx[q])
+				mask |= (uint64_t)1 << i;
+	}
+	return (mask);
+}
+
+
+/**
+ * filter_portable - Scalar prefilter, used when no vector unit is available
+ *
+ * @sub: Compiled matcher
+ * @s: Start of the block of 64 positions
+ * @avail: Number of readable bytes from @s
+ *
+ * Return: A mask whose bit i is set if position i may start a word
+ */
+static uint64_t filter_portable(const substring_t *sub, char const *s,
+				size_t avail)
+{
+	return (filter_scalar(sub, s, avail, 0));
+}
+
+#ifdef SUBSTRING_X86
+/**
+ * filter_sse2 - Prefilter testing 16 positions per step with SSE2
+ *
+ * Byte b of every position is compared at once against byte b of each
+ * prefix; a position survives if all its bytes match one prefix.
+ * Prefixes are read byte by byte in memory order, x86 being little-endian.
+ *
+ * @sub: Compiled matcher
+ * @s: Start of the block of 64 positions
+ * @avail: Number of readable bytes from @s
+ *
+ * Return: A mask whose bit i is set if position i may start a word
+ */
+__attribute__((target("sse2")))
+static uint64_t filter_sse2(const substring_t *sub, char const *s,
+			    size_t avail)
+{
+	__m128i v[4], hit, m, c;
+	const unsigned char *pb;
+	uint64_t mask = 0;
+	size_t i, b;
+	int q;
+
+	for (i = 0; i < 64 && i + 15 + sub->pfx_len <= avail; i += 16)
+	{
+		for (b = 0; b < sub->pfx_len; b++)
+			v[b] = _mm_loadu_si128((const __m128i *)(s + i + b));
+		hit = _mm_setzero_si128();
+		for (q = 0; q < sub->nb_pfx; q++)
+		{
+			pb = (const unsigned char *)(sub->pfx + q);
+			m = _mm_set1_epi8(-1);
+			for (b = 0; b < sub->pfx_len; b++)
+			{
+				c = _mm_set1_epi8((char)pb[b]);
+				c = _mm_cmpeq_epi8(v[b], c);
+				m = _mm_and_si128(m, c);
+			}
+			hit = _mm_or_si128(hit, m);
+		}
+		mask |= (uint64_t)(unsigned int)_mm_movemask_epi8(hit) << i;
+	}
+	return (i < 64 ? mask | filter_scalar(sub, s, avail, i) : mask);
+}
+
+
+/**
+ * filter_avx2 - Prefilter testing 32 positions per step with AVX2
+ *
+ * @sub: Compiled matcher
+ * @s: Start of the block of 64 positions
+ * @avail: Number of readable bytes from @s
+ *
+ * Return: A mask whose bit i is set if position i may start a word
+ */
+__attribute__((target("avx2")))
+static uint64_t filter_avx2(const substring_t *sub, char const *s,
+			    size_t avail)
+{
+	__m256i v[4], hit, m, c;
+	const unsigned char *pb;
+	uint64_t mask = 0;
+	size_t i, b;
+	int q;
+
+	for (i = 0; i < 64 && i + 31 + sub->pfx_len <= avail; i += 32)
+	{
+		for (b = 0; b < sub->pfx_len; b++)
+			v[b] = _mm256_loadu_si256((const __m256i *)(s + i + b));
+		hit = _mm256_setzero_si256();
+		for (q = 0; q < sub->nb_pfx; q++)
+		{
+			pb = (const unsigned char *)(sub->pfx + q);
+			m = _mm256_set1_epi8(-1);
+			for (b = 0; b < sub->pfx_len; b++)
+			{
+				c = _mm256_set1_epi8((char)pb[b]);
+				c = _mm256_cmpeq_epi8(v[b], c);
+				m = _mm256_and_si256(m, c);
+			}
+			hit = _mm256_or_si256(hit, m);
+		}
+		mask |= (uint64_t)(unsigned int)_mm256_movemask_epi8(hit) << i;
+	}
+	return (i < 64 ? mask | filter_scalar(sub, s, avail, i) : mask);
+}
+#endif /* SUBSTRING_X86 */
+
+
+/**
+ * substring_prefilter_init - Collects the word prefixes and picks the
+ * prefilter for the running CPU
+ *
+ * The prefilter is left disabled when the words have too many distinct
+ * prefixes for a bulk compare to beat the table lookup.
+ *
+ * @sub: Matcher being compiled, with its words interned
+ */
+void substring_prefilter_init(substring_t *sub)
+{
+	uint32_t w;
+	int id, q;
+
+	sub->pfx_len = sub->wlen < 4 ? sub->wlen : 4;
+	sub->nb_pfx = 0;
+	sub->filter = NULL;
+	for (id = 0; id < sub->nb_ids; id++)
+	{
+		w = 0;
+		memcpy(&w, sub->keys + id * sub->wlen, sub->pfx_len);
+		for (q = 0; q < sub->nb_pfx && sub->pfx[q] != w; q++)
+			;
+		if (q == SUBSTRING_PFX_MAX)
+			return;
+		if (q == sub->nb_pfx)
+			sub->pfx[sub->nb_pfx++] = w;
+	}
+	sub->filter = filter_portable;
+#ifdef SUBSTRING_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("sse2"))
+		sub->filter = filter_sse2;
+	if (__builtin_cpu_supports("avx2"))
+		sub->filter = filter_avx2;
+#endif
+}
@@ -0,0 +1,104 @@
+#include <stdlib.h>
+#include "substring.h"
+
+
+/**
+ * substring_result_push - Appends a match index to a result array
+ *
+ * Usable directly as the callback of substring_scan. The array grows
+ * geometrically, so its size follows the number of matches, not the
+ * length of the scanned string.
+ *
+ * @idx: Index to insert
+ * @data: Result array, as a substring_result_t
+ *
+ * Return: 0 on success, -1 on failure
+ */
+int substring_result_push(size_t idx, void *data)
+{
+	substring_result_t *res = data;
+	int *arr;
+
+	if (res->n == res->cap)
+	{
+		res->cap = res->cap ? res->cap * 2 : 16;
+		arr = realloc(res->arr, sizeof(*arr) * res->cap);
+		if (!arr)
+			return (-1);
+		res->arr = arr;
+	}
+	res->arr[res->n++] = (int)idx;
+	return (0);
+}
+
+
+/**
+ * substring_result_finish - Hands over the array of a result
+ *
+ * @res: Result array, emptied by the call
+ * @n: Address at which to store the number of elements in the returned array
+ *
+ * Return: The indices, trimmed to their count, or NULL if there are none
+ */
+int *substring_result_finish(substring_result_t *res, int *n)
+{
+	int *arr = res->arr, *fit;
+
+	*n = (int)res->n;
+	if (res->n == 0)
+	{
+		free(arr);
+		arr = NULL;
+	}
+	else if (res->n < res->cap)
+	{
+		fit = realloc(arr, sizeof(*arr) * res->n);
+		if (fit)
+			arr = fit;
+	}
+	res->arr = NULL;
+	res->n = 0;
+	res->cap = 0;
+	return (arr);
+}
+
+
+/**
+ * count_index - Counts one match
+ *
+ * @idx: Index of the match, unused
+ * @data: Counter, as a size_t
+ *
+ * Return: Always 0, to keep scanning
+ */
+static int count_index(size_t idx, void *data)
+{
+	(void)idx;
+	(*(size_t *)data)++;
+	return (0);
+}
+
+
+/**
+ * substring_count - Counts the substrings matched by a compiled matcher
+ *
+ * No result array is built, whatever the number of matches.
+ *
+ * @sub: Matcher built by substring_compile
+ * @s: Buffer to scan, need not be NUL-terminated
+ * @len: Length of @s
+ * @count: Receives the number of matches, left as is on failure
+ *
+ * Return: 0 on success, -1 on failure
+ */
+int substring_count(const substring_t *sub, char const *s, size_t len,
+		    size_t *count)
+{
+	size_t n = 0;
+
+	if (!sub || !s || !count ||
+	    substring_scan(sub, s, len, count_index, &n))
+		return (-1);
+	*count = n;
+	return (0);
+}
@@ -0,0 +1,123 @@
+#include <stdlib.h>
+#include <string.h>
+#include "substring.h"
+
+
+/**
+ * struct relay_s - Translates buffer-relative matches to stream offsets
+ *
+ * @st: Stream the buffer belongs to
+ * @base: Absolute offset of the buffer in the stream
+ */
+struct relay_s
+{
+	substring_stream_t *st;
+	uint64_t base;
+};
+
+
+/**
+ * relay_index - Forwards a match to the stream callback
+ *
+ * @idx: Index of the match in the scanned buffer
+ * @data: Relay, as a struct relay_s
+ *
+ * Return: The value returned by the stream callback
+ */
+static int relay_index(size_t idx, void *data)
+{
+	struct relay_s *relay = data;
+
+	return (relay->st->cb(relay->base + idx, relay->st->data));
+}
+
+
+/**
+ * substring_stream_new - Starts a scan over an input delivered in chunks
+ *
+ * @sub: Matcher to scan for, must outlive the stream
+ * @cb: Function called with the absolute index of each match, in order
+ * @data: Argument passed to @cb
+ *
+ * Return: The stream, or NULL on failure
+ */
+substring_stream_t *substring_stream_new(const substring_t *sub,
+					 substring_stream_cb_t cb, void *data)
+{
+	substring_stream_t *st;
+
+	if (!sub || !cb)
+		return (NULL);
+	st = calloc(1, sizeof(*st));
+	if (!st)
+		return (NULL);
+	st->sub = sub;
+	st->cb = cb;
+	st->data = data;
+	st->keep = sub->wlen * sub->nb_words - 1;
+	st->carry = malloc(2 * st->keep + 1);
+	if (!st->carry)
+	{
+		free(st);
+		return (NULL);
+	}
+	return (st);
+}
+
+
+/**
+ * substring_stream_feed - Scans the next chunk of a stream
+ *
+ * A match straddling the previous chunk is found by scanning the carried
+ * tail joined with the head of @buf; the rest of @buf is scanned in place.
+ *
+ * @st: Stream
+ * @buf: Next bytes of the input
+ * @len: Length of @buf
+ *
+ * Return: 0 on success, -1 on failure, or the non-zero value of the callback
+ */
+int substring_stream_feed(substring_stream_t *st, char const *buf, size_t len)
+{
+	struct relay_s relay;
+	size_t take = len < st->keep ? len : st->keep, drop;
+
+	relay.st = st;
+	if (st->ret)
+		return (st->ret);
+	memcpy(st->carry + st->carry_len, buf, take);
+	relay.base = st->offset;
+	st->ret = substring_scan(st->sub, st->carry, st->carry_len + take,
+				 relay_index, &relay);
+	relay.base = st->offset + st->carry_len;
+	if (!st->ret)
+		st->ret = substring_scan(st->sub, buf, len, relay_index,
+					 &relay);
+	if (len >= st->keep)
+	{
+		memcpy(st->carry, buf + len - st->keep, st->keep);
+		st->offset += st->carry_len + len - st->keep;
+		st->carry_len = st->keep;
+		return (st->ret);
+	}
+	st->carry_len += len;
+	drop = st->carry_len > st->keep ? st->carry_len - st->keep : 0;
+	memmove(st->carry, st->carry + drop, st->carry_len - drop);
+	st->carry_len -= drop;
+	st->offset += drop;
+	return (st->ret);
+}
+
+
+/**
+ * substring_stream_free - Ends a stream
+ *
+ * @st: Stream to free, may be NULL
+ */
+void substring_stream_free(substring_stream_t *st)
+{
+	if (!st)
+		return;
+	free(st->carry);
+	free(st);
+}
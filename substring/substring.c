@@ -4,54 +4,32 @@
 
 
 /**
- * match_all - Checks if all given words appear consecutively starting
- * from a position in the string
+ * substring_exec - Finds all the substrings matched by a compiled matcher
  *
+ * Only scans: the matcher is read, never written, so one matcher may be
+ * shared by concurrent calls.
+ *
+ * @sub: Matcher built by substring_compile
  * @s: String to scan
- * @words: Array of words all substrings must be a concatenation arrangement of
- * @nb_words: Number of elements in the array words
- * @wlen: Length of each word
+ * @n: Address at which to store the number of elements in the returned array
  *
- * Return: 1 if all words are found exactly once in any order,
- * 0 otherwise.
+ * Return: An allocated array, storing each index in s,
+ * at which a substring was found or NULL on failure
  */
-static int match_all(const char *s, const char **words, int nb_words, int wlen)
+int *substring_exec(const substring_t *sub, char const *s, int *n)
 {
-	int used[1000] = {0};
-	int i, j;
-	const char *seg;
+	substring_result_t res = {NULL, 0, 0};
 
-	for (i = 0; i < nb_words; i++)
-	{
-		seg = s + i * wlen;
-		for (j = 0; j < nb_words; j++)
-		{
-			if (!used[j] && strncmp(seg, words[j], wlen) == 0)
-			{
-				used[j] = 1;
-				break;
-			}
-		}
+	*n = 0;
+	if (!sub || !s)
+		return (NULL);
 
-		if (j == nb_words)
-		{
-			return (0);
-		}
+	if (substring_scan(sub, s, strlen(s), substring_result_push, &res))
+	{
+		free(res.arr);
+		return (NULL);
 	}
-	return (1);
-}
-
-
-/**
- * push_index - Inserts a found index into the result array
- * @arr: Array of indices where matches are stored
- * @n: Address at which to store the number of elements in the returned array
- * @idx: Index to insert
- */
-static void push_index(int *arr, int *n, int idx)
-{
-	arr[*n] = idx;
-	(*n)++;
+	return (substring_result_finish(&res, n));
 }
 
 
@@ -69,34 +47,14 @@ static void push_index(int *arr, int *n, int idx)
  */
 int *find_substring(const char *s, const char **words, int nb_words, int *n)
 {
-	int *res, i, wlen, total, len;
+	substring_t *sub;
+	int *res;
 
 	*n = 0;
-	if (!s || !words || nb_words < 1)
-	{
-		return (NULL);
-	}
-
-	wlen = strlen(words[0]);
-	len = strlen(s);
-	total = wlen * nb_words;
-
-	res = malloc(sizeof(int) * len);
-	if (!res)
-	{
+	if (!s)
 		return (NULL);
-	}
-
-	for (i = 0; i <= len - total; i++)
-	{
-		if (match_all(s + i, words, nb_words, wlen))
-			push_index(res, n, i);
-	}
-
-	if (*n == 0)
-	{
-		free(res);
-		return (NULL);
-	}
+	sub = substring_compile(words, nb_words);
+	res = substring_exec(sub, s, n);
+	substring_free(sub);
 	return (res);
 }
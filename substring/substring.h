@@ -1,6 +1,140 @@
 #ifndef SUBSTRING_H
 #define SUBSTRING_H
 
+#include <stddef.h>
+#include <stdint.h>
+
+#define SUBSTRING_PFX_MAX 8
+
+/**
+ * struct substring_s - Compiled word list, shared by the scanning engines
+ *
+ * A compiled matcher is never written to once built, so it can be used by
+ * any number of threads at once.
+ *
+ * @keys: Distinct words packed back to back, wlen bytes per word ID
+ * @need: Number of times each word ID appears in the word list
+ * @hash: Rolling hash of each word ID
+ * @slots: Open-addressing table of word IDs, -1 marks an empty slot
+ * @bits: Log2 of the number of slots
+ * @nb_ids: Number of distinct words
+ * @nb_words: Number of words, duplicates included
+ * @wlen: Length of every word
+ * @pow: Hash base raised to the power wlen - 1
+ * @pfx: Distinct word prefixes, pfx_len bytes each, zero-padded
+ * @pfx_len: Number of leading bytes compared by the prefilter
+ * @nb_pfx: Number of distinct word prefixes
+ * @filter: Prefilter picked for the running CPU, NULL when disabled
+ */
+struct substring_s
+{
+	char *keys;
+	int *need;
+	unsigned int *hash;
+	int *slots;
+	int bits;
+	int nb_ids;
+	int nb_words;
+	size_t wlen;
+	unsigned int pow;
+	uint32_t pfx[SUBSTRING_PFX_MAX];
+	size_t pfx_len;
+	int nb_pfx;
+	uint64_t (*filter)(const struct substring_s *sub, char const *s,
+			   size_t avail);
+};
+
+typedef struct substring_s substring_t;
+
+/**
+ * substring_cb_t - Receives each match index found by a scan
+ * Return non-zero to stop the scan, that value is then returned by the scan
+ */
+typedef int (*substring_cb_t)(size_t idx, void *data);
+
+/**
+ * struct substring_result_s - Growable array of match indices
+ *
+ * Zero-initialize it, then pass it as the data of substring_result_push.
+ *
+ * @arr: Indices found so far
+ * @n: Number of elements stored in @arr
+ * @cap: Number of elements @arr can hold
+ */
+struct substring_result_s
+{
+	int *arr;
+	size_t n;
+	size_t cap;
+};
+
+typedef struct substring_result_s substring_result_t;
+
+/**
+ * substring_stream_cb_t - Receives each match found in a stream
+ * Match indices are absolute offsets from the start of the stream.
+ * Return non-zero to stop the stream, that value is then returned by it
+ */
+typedef int (*substring_stream_cb_t)(uint64_t idx, void *data);
+
+/**
+ * struct substring_stream_s - Scan of an input delivered in chunks
+ *
+ * @sub: Matcher the stream scans for
+ * @cb: Function called with the absolute index of each match
+ * @data: Argument passed to @cb
+ * @carry: Last span - 1 bytes of input, with room for as many more
+ * @keep: Number of bytes carried between chunks, span - 1
+ * @carry_len: Number of bytes currently held by @carry
+ * @offset: Absolute offset of @carry in the stream
+ * @ret: First non-zero status returned by a scan, sticky
+ */
+struct substring_stream_s
+{
+	const substring_t *sub;
+	substring_stream_cb_t cb;
+	void *data;
+	char *carry;
+	size_t keep;
+	size_t carry_len;
+	uint64_t offset;
+	int ret;
+};
+
+typedef struct substring_stream_s substring_stream_t;
+
+#define SUBSTRING_HASH_BASE 257U
+#define SUBSTRING_CHUNK 65536
+#define SUBSTRING_MMAP_MIN (1 << 20)
+#define SUBSTRING_PART_MIN (1 << 16)
+
 int *find_substring(char const *s, char const **words, int nb_words, int *n);
 
+substring_t *substring_compile(char const **words, int nb_words);
+int *substring_exec(const substring_t *sub, char const *s, int *n);
+int *substring_exec_parallel(const substring_t *sub, char const *s, int *n,
+			     int nthreads);
+void substring_free(substring_t *sub);
+
+int substring_result_push(size_t idx, void *data);
+int *substring_result_finish(substring_result_t *res, int *n);
+int substring_count(const substring_t *sub, char const *s, size_t len,
+		    size_t *count);
+
+substring_stream_t *substring_stream_new(const substring_t *sub,
+					 substring_stream_cb_t cb, void *data);
+int substring_stream_feed(substring_stream_t *st, char const *buf,
+			  size_t len);
+void substring_stream_free(substring_stream_t *st);
+int substring_scan_fd(const substring_t *sub, int fd,
+		      substring_stream_cb_t cb, void *data);
+int substring_scan_file(const substring_t *sub, char const *path,
+			substring_stream_cb_t cb, void *data);
+
+unsigned int substring_hash(char const *w, size_t wlen);
+int substring_lookup(const substring_t *sub, char const *w, unsigned int h);
+void substring_prefilter_init(substring_t *sub);
+int substring_scan(const substring_t *sub, char const *s, size_t len,
+		   substring_cb_t cb, void *data);
+
 #endif /* SUBSTRING_H */
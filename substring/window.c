@@ -0,0 +1,159 @@
+#include <stdlib.h>
+#include "substring.h"
+
+
+/**
+ * struct window_s - State of the wlen interleaved sliding windows
+ *
+ * Lane r covers the positions congruent to r modulo wlen, so every
+ * concatenation of words is seen by exactly one lane.
+ *
+ * @count: Occurrences of each word ID in each lane's window
+ * @ring: Word IDs held by each lane's window, oldest first
+ * @head: Ring index of the oldest word of each lane
+ * @have: Number of words held by each lane's window
+ */
+struct window_s
+{
+	int *count;
+	int *ring;
+	int *head;
+	int *have;
+};
+
+typedef struct window_s window_t;
+
+
+/**
+ * window_init - Allocates the lanes of a scan
+ *
+ * @win: Windows to initialize
+ * @sub: Compiled matcher
+ *
+ * Return: 0 on success, -1 on failure
+ */
+static int window_init(window_t *win, const substring_t *sub)
+{
+	win->count = calloc(sub->wlen * sub->nb_ids, sizeof(*win->count));
+	win->ring = malloc(sizeof(*win->ring) * sub->wlen * sub->nb_words);
+	win->head = calloc(sub->wlen, sizeof(*win->head));
+	win->have = calloc(sub->wlen, sizeof(*win->have));
+	if (!win->count || !win->ring || !win->head || !win->have)
+	{
+		free(win->count);
+		free(win->ring);
+		free(win->head);
+		free(win->have);
+		return (-1);
+	}
+	return (0);
+}
+
+
+/**
+ * lane_pop - Drops the oldest word of a lane's window
+ *
+ * @sub: Compiled matcher
+ * @win: Windows of the scan
+ * @lane: Lane to shrink
+ */
+static void lane_pop(const substring_t *sub, window_t *win, size_t lane)
+{
+	int *ring = win->ring + lane * sub->nb_words;
+	int *count = win->count + lane * sub->nb_ids;
+
+	count[ring[win->head[lane]]]--;
+	if (++win->head[lane] == sub->nb_words)
+		win->head[lane] = 0;
+	win->have[lane]--;
+}
+
+
+/**
+ * lane_push - Appends a word to a lane's window
+ *
+ * @sub: Compiled matcher
+ * @win: Windows of the scan
+ * @lane: Lane the word belongs to
+ * @id: Word ID, or -1 if the position does not hold a word
+ *
+ * Return: 1 if the window now holds every word exactly, 0 otherwise
+ */
+static int lane_push(const substring_t *sub, window_t *win, size_t lane,
+		     int id)
+{
+	int *ring = win->ring + lane * sub->nb_words;
+	int *count = win->count + lane * sub->nb_ids;
+
+	if (id == -1)
+	{
+		while (win->have[lane])
+			lane_pop(sub, win, lane);
+		return (0);
+	}
+	ring[(win->head[lane] + win->have[lane]) % sub->nb_words] = id;
+	win->have[lane]++;
+	count[id]++;
+	while (count[id] > sub->need[id])
+		lane_pop(sub, win, lane);
+	return (win->have[lane] == sub->nb_words);
+}
+
+
+/**
+ * substring_scan - Reports every concatenation of the words in a buffer
+ *
+ * Each position is hashed once with a rolling hash and fed to its lane,
+ * so the scan runs in O(len) whatever the number of words. Positions
+ * rejected by the prefilter, 64 at a time, skip the table lookup.
+ * Matches are reported in increasing order.
+ *
+ * @sub: Compiled matcher
+ * @s: Buffer to scan, need not be NUL-terminated
+ * @len: Length of @s
+ * @cb: Function called with the index of each match
+ * @data: Argument passed to @cb
+ *
+ * Return: 0 on success, -1 on failure, or the non-zero value of @cb
+ */
+int substring_scan(const substring_t *sub, char const *s, size_t len,
+		   substring_cb_t cb, void *data)
+{
+	window_t win;
+	size_t p, lane = 0, span = sub->wlen * sub->nb_words;
+	uint64_t mask = ~(uint64_t)0;
+	unsigned int h;
+	int id, ret = 0;
+
+	if (len < span)
+		return (0);
+	if (window_init(&win, sub) == -1)
+		return (-1);
+	h = substring_hash(s, sub->wlen);
+	for (p = 0; ; p++)
+	{
+		if (sub->filter && (p & 63) == 0)
+			mask = sub->filter(sub, s + p, len - p);
+		id = -1;
+		if ((mask >> (p & 63)) & 1)
+			id = substring_lookup(sub, s + p, h);
+		if (lane_push(sub, &win, lane, id))
+		{
+			lane_pop(sub, &win, lane);
+			ret = cb(p + sub->wlen - span, data);
+			if (ret)
+				break;
+		}
+		if (p + sub->wlen == len)
+			break;
+		h = (h - (unsigned char)s[p] * sub->pow) * SUBSTRING_HASH_BASE +
+			(unsigned char)s[p + sub->wlen];
+		if (++lane == sub->wlen)
+			lane = 0;
+	}
+	free(win.count);
+	free(win.ring);
+	free(win.head);
+	free(win.have);
+	return (ret);
+}
@@ -0,0 +1,142 @@
+#include <stdlib.h>
+#include <string.h>
+#include "substring.h"
+
+
+/**
+ * substring_hash - Computes the rolling hash of a word
+ *
+ * @w: Word to hash
+ * @wlen: Number of bytes of @w to hash
+ *
+ * Return: The hash, compatible with the rolling update of substring_scan
+ */
+unsigned int substring_hash(char const *w, size_t wlen)
+{
+	unsigned int h = 0;
+	size_t i;
+
+	for (i = 0; i < wlen; i++)
+		h = h * SUBSTRING_HASH_BASE + (unsigned char)w[i];
+	return (h);
+}
+
+
+/**
+ * substring_lookup - Finds the ID of the word starting at a position
+ *
+ * @sub: Compiled matcher
+ * @w: Start of the candidate word, at least wlen bytes long
+ * @h: Hash of the candidate word
+ *
+ * Return: The word ID, or -1 if the candidate is not in the list
+ */
+int substring_lookup(const substring_t *sub, char const *w, unsigned int h)
+{
+	size_t mask = ((size_t)1 << sub->bits) - 1, i;
+	int id;
+
+	i = (size_t)((h * 2654435761U) >> (32 - sub->bits));
+	while ((id = sub->slots[i]) != -1)
+	{
+		if (sub->hash[id] == h &&
+		    memcmp(sub->keys + id * sub->wlen, w, sub->wlen) == 0)
+			return (id);
+		i = (i + 1) & mask;
+	}
+	return (-1);
+}
+
+
+/**
+ * intern_word - Adds one occurrence of a word to the table
+ *
+ * @sub: Matcher being compiled
+ * @w: Word to add
+ */
+static void intern_word(substring_t *sub, char const *w)
+{
+	size_t mask = ((size_t)1 << sub->bits) - 1, i;
+	unsigned int h = substring_hash(w, sub->wlen);
+	int id = substring_lookup(sub, w, h);
+
+	if (id == -1)
+	{
+		id = sub->nb_ids++;
+		memcpy(sub->keys + id * sub->wlen, w, sub->wlen);
+		sub->hash[id] = h;
+		sub->need[id] = 0;
+		i = (size_t)((h * 2654435761U) >> (32 - sub->bits));
+		while (sub->slots[i] != -1)
+			i = (i + 1) & mask;
+		sub->slots[i] = id;
+	}
+	sub->need[id]++;
+}
+
+
+/**
+ * substring_compile - Builds a reusable matcher for a list of words
+ *
+ * The words are copied, so the list may be released once compiled.
+ *
+ * @words: Array of words, all of the same length
+ * @nb_words: Number of elements in the array words
+ *
+ * Return: The matcher, or NULL on failure or if no word could ever match
+ */
+substring_t *substring_compile(char const **words, int nb_words)
+{
+	substring_t *sub;
+	size_t i, wlen;
+
+	if (!words || nb_words < 1 || !words[0])
+		return (NULL);
+	wlen = strlen(words[0]);
+	for (i = 0; i < (size_t)nb_words; i++)
+		if (!words[i] || strlen(words[i]) < wlen)
+			return (NULL);
+	sub = calloc(1, sizeof(*sub));
+	if (wlen == 0 || !sub)
+	{
+		free(sub);
+		return (NULL);
+	}
+	sub->wlen = wlen;
+	sub->nb_words = nb_words;
+	for (sub->bits = 1; ((size_t)1 << sub->bits) < 2 * i; sub->bits++)
+		;
+	sub->keys = malloc(wlen * nb_words);
+	sub->need = malloc(sizeof(*sub->need) * nb_words);
+	sub->hash = malloc(sizeof(*sub->hash) * nb_words);
+	sub->slots = malloc(sizeof(*sub->slots) << sub->bits);
+	if (!sub->keys || !sub->need || !sub->hash || !sub->slots)
+	{
+		substring_free(sub);
+		return (NULL);
+	}
+	memset(sub->slots, -1, sizeof(*sub->slots) << sub->bits);
+	for (sub->pow = 1, i = 1; i < wlen; i++)
+		sub->pow *= SUBSTRING_HASH_BASE;
+	for (i = 0; i < (size_t)nb_words; i++)
+		intern_word(sub, words[i]);
+	substring_prefilter_init(sub);
+	return (sub);
+}
+
+
+/**
+ * substring_free - Frees a matcher built by substring_compile
+ *
+ * @sub: Matcher to free, may be NULL
+ */
+void substring_free(substring_t *sub)
+{
+	if (!sub)
+		return;
+	free(sub->keys);
+	free(sub->need);
+	free(sub->hash);
+	free(sub->slots);
+	free(sub);
+}
@@ -6,30 +6,45 @@
 /**
  * wildcmp - compares two strings
  *
+ * Walks both strings once, remembering only the last '*' seen in s2 and
+ * where s1 stood when it was met. On a mismatch, that star is made to
+ * swallow one more character and matching resumes right after it.
+ * Earlier stars never need revisiting, so this runs in O(len(s1) x
+ * len(s2)) worst case with O(1) memory and no recursion.
+ *
  * @s1: first string
- * @s2: second string
+ * @s2: second string, may contain '*' wildcards
  *
  * Return: 1 if the strings can be considered identical,
  * otherwise return 0
  */
 int wildcmp(char *s1, char *s2)
 {
-	if (*s1 == '\0' && *s2 == '\0')
-		return (1);
+	char *star = NULL, *resume = NULL;
 
-	if (*s2 == '*')
+	while (*s1 != '\0')
 	{
-		if (wildcmp(s1, s2 + 1))
-			return (1);
-
-		if (*s1 != '\0' && wildcmp(s1 + 1, s2))
-			return (1);
-
-		return (0);
+		if (*s2 == '*')
+		{
+			star = s2++;
+			resume = s1;
+		}
+		else if (*s1 == *s2)
+		{
+			s1++;
+			s2++;
+		}
+		else if (star)
+		{
+			s2 = star + 1;
+			s1 = ++resume;
+		}
+		else
+			return (0);
 	}
 
-	if (*s1 == *s2)
-		return (wildcmp(s1 + 1, s2 + 1));
+	while (*s2 == '*')
+		s2++;
 
-	return (0);
+	return (*s2 == '\0');
 }
@@ -0,0 +1,30 @@
+#include "holberton.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * main - Compiles a few patterns once and checks each string against
+ * them with wildcmp_exec, next to the result of wildcmp
+ *
+ * Return: 0 on success, 1 if a pattern cannot be compiled
+ */
+int main(void)
+{
+    char *pats[] = {"*.c", "m*a*i*n*.*c*", "ma*in.c", "main*d", "*b"};
+    char *strs[] = {"main.c", "main-main.c", "main", "abc"};
+    wildcmp_prog_t *prog;
+    size_t p, s;
+
+    for (p = 0; p < sizeof(pats) / sizeof(*pats); p++)
+    {
+        prog = wildcmp_compile(pats[p]);
+        if (!prog)
+            return (1);
+        for (s = 0; s < sizeof(strs) / sizeof(*strs); s++)
+            printf("%-12s %-12s %d %d\n", pats[p], strs[s],
+                   wildcmp_exec(prog, strs[s], strlen(strs[s])),
+                   wildcmp(strs[s], pats[p]));
+        wildcmp_free(prog);
+    }
+    return (0);
+}
@@ -0,0 +1,75 @@
+#include "holberton.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NPATHS 100000
+
+/**
+ * check_filter - Filters a list on a number of threads and checks the
+ * result against wildcmp_set_exec, string by string
+ *
+ * @set: Compiled patterns
+ * @paths: Strings to filter
+ * @bits: Room for the bitmap
+ * @first: Room for the first matching pattern of each string
+ * @nthreads: Number of threads
+ *
+ * Return: Number of matching strings, or -1 on error or mismatch
+ */
+long check_filter(wildcmp_set_t *set, char const **paths,
+                  unsigned char *bits, int *first, int nthreads)
+{
+    long count = 0;
+    size_t i;
+    int idx;
+
+    if (wildcmp_filter(set, paths, NPATHS, bits, first, nthreads))
+        return (-1);
+    for (i = 0; i < NPATHS; i++)
+    {
+        idx = wildcmp_set_exec(set, paths[i], strlen(paths[i]));
+        if (first[i] != idx || !(bits[i / 8] >> (i % 8) & 1) != (idx == -1))
+            return (-1);
+        count += idx != -1;
+    }
+    return (count);
+}
+
+/**
+ * main - Matches a few paths against a set of patterns, then filters a
+ * list of generated paths on 1 to 4 threads
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(void)
+{
+    char const *pats[] = {"*.o", "*.tmp", "*/cache/*"};
+    char const *dirs[] = {"src", "build", "home/cache", "tmp"};
+    char const *exts[] = {".c", ".o", ".tmp", ".h", ".txt"};
+    char const *paths[NPATHS];
+    static char buf[NPATHS][32];
+    static unsigned char bits[(NPATHS + 7) / 8];
+    static int first[NPATHS];
+    wildcmp_set_t *set;
+    size_t i;
+    int t;
+
+    set = wildcmp_set_compile(pats, 3);
+    if (!set)
+        return (1);
+    for (i = 0; i < NPATHS; i++)
+    {
+        sprintf(buf[i], "%s/f%lu%s", dirs[i % 4], (unsigned long)i,
+                exts[i % 5]);
+        paths[i] = buf[i];
+    }
+    for (i = 0; i < 5; i++)
+        printf("%-18s %d\n", paths[i],
+               wildcmp_set_exec(set, paths[i], strlen(paths[i])));
+    for (t = 1; t <= 4; t++)
+        printf("%d thread(s): %ld matches\n", t,
+               check_filter(set, paths, bits, first, t));
+    wildcmp_set_free(set);
+    return (0);
+}
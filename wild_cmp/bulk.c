@@ -0,0 +1,136 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "holberton.h"
+
+
+/**
+ * struct filter_job_s - What wildcmp_filter was asked to do
+ *
+ * @set: Compiled patterns
+ * @strs: Every string to match
+ * @out: Match bitmap, may be NULL
+ * @first: Index of the first matching pattern per string, may be NULL
+ */
+struct filter_job_s
+{
+	const wildcmp_set_t *set;
+	char const **strs;
+	unsigned char *out;
+	int *first;
+};
+
+
+/**
+ * struct filter_run_s - Run of consecutive strings given to one thread
+ *
+ * @job: Call the strings belong to
+ * @lo: Index of the first string of the run; a multiple of 8, so that
+ * the run owns whole bytes of the bitmap
+ * @hi: Index past the last string of the run
+ * @tid: Thread matching the run
+ * @started: 1 if @tid was started, 0 if the run was matched inline
+ */
+struct filter_run_s
+{
+	const struct filter_job_s *job;
+	size_t lo;
+	size_t hi;
+	pthread_t tid;
+	int started;
+};
+
+
+/**
+ * filter_run - Thread routine matching a run of strings against the set
+ *
+ * @arg: Run, as a struct filter_run_s
+ *
+ * Return: Always NULL
+ */
+static void *filter_run(void *arg)
+{
+	struct filter_run_s *run = arg;
+	const struct filter_job_s *job = run->job;
+	unsigned char bit;
+	size_t i;
+	int idx;
+
+	for (i = run->lo; i < run->hi; i++)
+	{
+		idx = -1;
+		if (job->strs[i])
+			idx = wildcmp_set_exec(job->set, job->strs[i],
+					       strlen(job->strs[i]));
+		if (job->first)
+			job->first[i] = idx;
+		if (!job->out)
+			continue;
+		bit = (unsigned char)(1U << (i % 8));
+		if (idx != -1)
+			job->out[i / 8] |= bit;
+		else
+			job->out[i / 8] &= (unsigned char)~bit;
+	}
+	return (NULL);
+}
+
+
+/**
+ * wildcmp_filter - Matches many strings against a set of patterns
+ *
+ * Each thread gets a run of at least WILDCMP_BULK_MIN strings and reads
+ * the same compiled set. A short list, or a single thread, is matched on
+ * the calling thread without allocating anything.
+ *
+ * @set: Patterns built by wildcmp_set_compile
+ * @strs: Strings to match
+ * @n: Number of strings
+ * @out_bits: Bitmap of at least (n + 7) / 8 bytes, or NULL; bit i % 8 of
+ * byte i / 8 is set if a pattern matches strs[i] and cleared otherwise,
+ * other bits are kept
+ * @first: Array of n elements, or NULL; receives the index of the first
+ * pattern matching each string, -1 if none does
+ * @nthreads: Maximum number of threads, 0 for one per online CPU
+ *
+ * Return: 0 on success, -1 on failure
+ */
+int wildcmp_filter(const wildcmp_set_t *set, char const **strs, size_t n,
+		   unsigned char *out_bits, int *first, int nthreads)
+{
+	struct filter_job_s job;
+	struct filter_run_s one, *runs = &one;
+	size_t nruns, len, i;
+
+	if (!set || nthreads < 0 || (n && !strs))
+		return (-1);
+	job.set = set;
+	job.strs = strs;
+	job.out = out_bits;
+	job.first = first;
+	nruns = nthreads > 0 ? nthreads : sysconf(_SC_NPROCESSORS_ONLN);
+	if (nruns > n / WILDCMP_BULK_MIN)
+		nruns = n / WILDCMP_BULK_MIN;
+	len = nruns > 1 ? ((n + nruns - 1) / nruns + 7) & ~(size_t)7 : n;
+	nruns = nruns > 1 ? (n + len - 1) / len : 1;
+	if (nruns > 1 && !(runs = malloc(sizeof(*runs) * nruns)))
+		return (-1);
+	for (i = 0; i < nruns; i++)
+	{
+		runs[i].job = &job;
+		runs[i].lo = i * len;
+		runs[i].hi = i + 1 < nruns ? runs[i].lo + len : n;
+		runs[i].started = nruns > 1 &&
+			!pthread_create(&runs[i].tid, NULL, filter_run,
+					runs + i);
+		if (!runs[i].started)
+			filter_run(runs + i);
+	}
+	for (i = 0; i < nruns; i++)
+		if (runs[i].started)
+			pthread_join(runs[i].tid, NULL);
+	if (runs != &one)
+		free(runs);
+	return (0);
+}
@@ -0,0 +1,131 @@
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <string.h>
+#include "holberton.h"
+
+
+/**
+ * split_pattern - Copies the literal runs of a pattern
+ *
+ * Runs between two stars are recorded as floating segments, empty ones
+ * (from consecutive stars) are dropped.
+ *
+ * @prog: Pattern being compiled, with room for the runs
+ * @pat: Pattern, '*' matching any string
+ */
+static void split_pattern(wildcmp_prog_t *prog, char const *pat)
+{
+	char const *first = strchr(pat, '*'), *last = strrchr(pat, '*'), *end;
+	char *out = prog->lits;
+	size_t n;
+
+	prog->star = first != NULL;
+	prog->head = first ? (size_t)(first - pat) : strlen(pat);
+	memcpy(out, pat, prog->head);
+	out += prog->head;
+	if (!first)
+	{
+		prog->min_len = prog->head;
+		return;
+	}
+	for (pat = first + 1; pat < last; pat = end + 1)
+	{
+		end = strchr(pat, '*');
+		n = end - pat;
+		if (n == 0)
+			continue;
+		prog->segs[prog->nsegs].s = out;
+		prog->segs[prog->nsegs++].len = n;
+		memcpy(out, pat, n);
+		out += n;
+	}
+	prog->tail = strlen(last + 1);
+	memcpy(out, last + 1, prog->tail);
+	prog->min_len = out + prog->tail - prog->lits;
+}
+
+
+/**
+ * wildcmp_compile - Prepares a pattern for matching many strings
+ *
+ * The pattern is copied, so it may be released once compiled.
+ *
+ * @pat: Pattern, '*' matching any string, including an empty one
+ *
+ * Return: The compiled pattern, or NULL on failure
+ */
+wildcmp_prog_t *wildcmp_compile(char const *pat)
+{
+	wildcmp_prog_t *prog;
+	size_t len;
+
+	if (!pat)
+		return (NULL);
+	prog = calloc(1, sizeof(*prog));
+	if (!prog)
+		return (NULL);
+	len = strlen(pat);
+	prog->lits = malloc(len + 1);
+	prog->segs = malloc(sizeof(*prog->segs) * (len / 2 + 1));
+	if (!prog->lits || !prog->segs)
+	{
+		wildcmp_free(prog);
+		return (NULL);
+	}
+	split_pattern(prog, pat);
+	return (prog);
+}
+
+
+/**
+ * wildcmp_exec - Compares a string with a compiled pattern
+ *
+ * The anchored runs are compared in place, then each floating run is
+ * searched with memmem, leftmost first: taking the earliest occurrence
+ * always leaves the most room for the next runs, so no backtracking is
+ * ever needed. Same result as wildcmp.
+ *
+ * @prog: Pattern built by wildcmp_compile
+ * @s: String to compare, need not be NUL-terminated
+ * @len: Length of @s
+ *
+ * Return: 1 if the string matches the pattern, 0 otherwise
+ */
+int wildcmp_exec(const wildcmp_prog_t *prog, char const *s, size_t len)
+{
+	char const *p, *end, *hit;
+	size_t i;
+
+	if (!prog || !s || len < prog->min_len ||
+	    (!prog->star && len != prog->min_len))
+		return (0);
+	if (memcmp(s, prog->lits, prog->head) != 0 ||
+	    memcmp(s + len - prog->tail,
+		   prog->lits + prog->min_len - prog->tail, prog->tail) != 0)
+		return (0);
+	p = s + prog->head;
+	end = s + len - prog->tail;
+	for (i = 0; i < prog->nsegs; i++)
+	{
+		hit = memmem(p, end - p, prog->segs[i].s, prog->segs[i].len);
+		if (!hit)
+			return (0);
+		p = hit + prog->segs[i].len;
+	}
+	return (1);
+}
+
+
+/**
+ * wildcmp_free - Frees a pattern built by wildcmp_compile
+ *
+ * @prog: Pattern to free, may be NULL
+ */
+void wildcmp_free(wildcmp_prog_t *prog)
+{
+	if (!prog)
+		return;
+	free(prog->lits);
+	free(prog->segs);
+	free(prog);
+}
@@ -1,9 +1,80 @@
 #ifndef HOLBERTON_H
 #define HOLBERTON_H
 
+#include <stddef.h>
+
+/**
+ * struct wildcmp_seg_s - Literal run of a pattern, between two stars
+ *
+ * @s: First character of the run, inside the literals of the pattern
+ * @len: Length of the run, never 0
+ */
+struct wildcmp_seg_s
+{
+	char const *s;
+	size_t len;
+};
+
+typedef struct wildcmp_seg_s wildcmp_seg_t;
+
+/**
+ * struct wildcmp_prog_s - Pattern split into its literal runs
+ *
+ * A compiled pattern is never written to once built, so it can be used by
+ * any number of threads at once.
+ *
+ * @lits: Characters of the pattern, stars removed
+ * @segs: Runs that may float, between the first and the last star
+ * @nsegs: Number of elements in @segs
+ * @head: Length of the run anchored at the start of the string
+ * @tail: Length of the run anchored at the end, 0 without a star
+ * @min_len: Shortest string the pattern can match, length of @lits
+ * @star: 1 if the pattern holds a star, 0 if it is a plain string
+ */
+struct wildcmp_prog_s
+{
+	char *lits;
+	wildcmp_seg_t *segs;
+	size_t nsegs;
+	size_t head;
+	size_t tail;
+	size_t min_len;
+	int star;
+};
+
+typedef struct wildcmp_prog_s wildcmp_prog_t;
+
+/**
+ * struct wildcmp_set_s - Patterns compiled once, matched together
+ *
+ * @progs: Compiled patterns, in the order they were given
+ * @nprogs: Number of elements in @progs
+ * @min_len: Shortest string any of the patterns can match
+ */
+struct wildcmp_set_s
+{
+	wildcmp_prog_t **progs;
+	size_t nprogs;
+	size_t min_len;
+};
+
+typedef struct wildcmp_set_s wildcmp_set_t;
+
+#define WILDCMP_BULK_MIN 1024
+
 int voys2(char *s2);
 int voys1(char *s1, char *s2);
 int compar(char *s1, char *s2);
 int wildcmp(char *s1, char *s2);
 
+wildcmp_prog_t *wildcmp_compile(char const *pat);
+int wildcmp_exec(const wildcmp_prog_t *prog, char const *s, size_t len);
+void wildcmp_free(wildcmp_prog_t *prog);
+
+wildcmp_set_t *wildcmp_set_compile(char const **pats, size_t npats);
+int wildcmp_set_exec(const wildcmp_set_t *set, char const *s, size_t len);
+void wildcmp_set_free(wildcmp_set_t *set);
+int wildcmp_filter(const wildcmp_set_t *set, char const **strs, size_t n,
+		   unsigned char *out_bits, int *first, int nthreads);
+
 #endif /* HOLBERTON_H */
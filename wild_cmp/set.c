@@ -0,0 +1,84 @@
+#include <stdlib.h>
+#include "holberton.h"
+
+
+/**
+ * wildcmp_set_compile - Compiles a list of patterns once for a whole batch
+ *
+ * The patterns are copied, so the list may be released once compiled.
+ *
+ * @pats: Patterns, '*' matching any string
+ * @npats: Number of elements in @pats
+ *
+ * Return: The compiled set, or NULL on failure
+ */
+wildcmp_set_t *wildcmp_set_compile(char const **pats, size_t npats)
+{
+	wildcmp_set_t *set;
+	size_t i;
+
+	if (!pats && npats)
+		return (NULL);
+	set = calloc(1, sizeof(*set));
+	if (!set)
+		return (NULL);
+	set->progs = calloc(npats + 1, sizeof(*set->progs));
+	if (!set->progs)
+	{
+		free(set);
+		return (NULL);
+	}
+	set->min_len = (size_t)-1;
+	for (i = 0; i < npats; i++, set->nprogs++)
+	{
+		set->progs[i] = wildcmp_compile(pats[i]);
+		if (!set->progs[i])
+		{
+			wildcmp_set_free(set);
+			return (NULL);
+		}
+		if (set->progs[i]->min_len < set->min_len)
+			set->min_len = set->progs[i]->min_len;
+	}
+	return (set);
+}
+
+
+/**
+ * wildcmp_set_exec - Finds the first pattern of a set matching a string
+ *
+ * @set: Patterns built by wildcmp_set_compile
+ * @s: String to compare, need not be NUL-terminated
+ * @len: Length of @s
+ *
+ * Return: The index of the first matching pattern, -1 if none matches
+ */
+int wildcmp_set_exec(const wildcmp_set_t *set, char const *s, size_t len)
+{
+	size_t i;
+
+	if (!set || !s || len < set->min_len)
+		return (-1);
+	for (i = 0; i < set->nprogs; i++)
+		if (wildcmp_exec(set->progs[i], s, len))
+			return ((int)i);
+	return (-1);
+}
+
+
+/**
+ * wildcmp_set_free - Frees a set built by wildcmp_set_compile
+ *
+ * @set: Set to free, may be NULL
+ */
+void wildcmp_set_free(wildcmp_set_t *set)
+{
+	size_t i;
+
+	if (!set)
+		return;
+	for (i = 0; i < set->nprogs; i++)
+		wildcmp_free(set->progs[i]);
+	free(set->progs);
+	free(set);
+}